@@ -18,7 +18,9 @@
 #include "s2geography/linear-referencing.h"
 #include "s2geography/operation.h"
 #include "s2geography/predicates.h"
+#include "s2geography/sedona_udf/cell_kernels.h"
 #include "s2geography/sedona_udf/sedona_extension.h"
+#include "s2geography/sedona_udf/sedona_udf_internal.h"
 
 // Helper macros
 
@@ -178,7 +180,7 @@ uint64_t S2GeogLngLatToCellId(const struct S2GeogVertex* v) {
 
 using KernelInitFunc = void (*)(struct SedonaCScalarKernel*);
 
-static const std::array<KernelInitFunc, 29> kSedonaKernels = {{
+static const std::array<KernelInitFunc, 60> kSedonaKernels = {{
     s2geography::sedona_udf::AreaKernel,
     s2geography::sedona_udf::CentroidKernel,
     s2geography::sedona_udf::ClosestPointKernel,
@@ -196,6 +198,8 @@ static const std::array<KernelInitFunc, 29> kSedonaKernels = {{
     s2geography::sedona_udf::LengthKernel,
     s2geography::sedona_udf::LineInterpolatePointKernel,
     s2geography::sedona_udf::LineLocatePointKernel,
+    s2geography::sedona_udf::LineInterpolatePointsKernel,
+    s2geography::sedona_udf::LineSubstringKernel,
     [](SedonaCScalarKernel* k) {
       s2geography::sedona_udf::MaxDistanceKernel(k);
     },
@@ -210,14 +214,43 @@ static const std::array<KernelInitFunc, 29> kSedonaKernels = {{
     s2geography::sedona_udf::BufferKernel,
     s2geography::sedona_udf::BufferQuadSegsKernel,
     s2geography::sedona_udf::BufferParamsKernel,
+    s2geography::sedona_udf::SubdivideKernel,
     [](SedonaCScalarKernel* k) {
       s2geography::sedona_udf::DistanceWithinKernel(k);
     },
     s2geography::sedona_udf::CellIdFromPointKernel,
+    s2geography::sedona_udf::CellIdFromLngLatKernel,
+    s2geography::sedona_udf::CellIdFromNativePointKernel,
     s2geography::sedona_udf::CoveringCellIdsKernel,
+    s2geography::sedona_udf::CellUnionNormalizeKernel,
+    s2geography::sedona_udf::CellUnionUnionKernel,
+    s2geography::sedona_udf::CellUnionIntersectionKernel,
+    s2geography::sedona_udf::CellUnionContainsKernel,
+    s2geography::sedona_udf::CellUnionIntersectsKernel,
+    s2geography::sedona_udf::HilbertOrderKernel,
     [](SedonaCScalarKernel* k) {
       s2geography::sedona_udf::LongestLineKernel(k);
     },
+    s2geography::sedona_udf::CellFromTokenKernel,
+    s2geography::sedona_udf::CellFromDebugStringKernel,
+    s2geography::sedona_udf::CellToTokenKernel,
+    s2geography::sedona_udf::CellToDebugStringKernel,
+    s2geography::sedona_udf::CellIsValidKernel,
+    s2geography::sedona_udf::CellCenterKernel,
+    s2geography::sedona_udf::CellVertexKernel,
+    s2geography::sedona_udf::CellLevelKernel,
+    s2geography::sedona_udf::CellRangeMinKernel,
+    s2geography::sedona_udf::CellRangeMaxKernel,
+    s2geography::sedona_udf::CellAreaKernel,
+    s2geography::sedona_udf::CellAreaApproxKernel,
+    s2geography::sedona_udf::CellParentKernel,
+    s2geography::sedona_udf::CellChildKernel,
+    s2geography::sedona_udf::CellEdgeNeighborKernel,
+    s2geography::sedona_udf::CellContainsKernel,
+    s2geography::sedona_udf::CellMayIntersectKernel,
+    s2geography::sedona_udf::CellDistanceKernel,
+    s2geography::sedona_udf::CellMaxDistanceKernel,
+    s2geography::sedona_udf::CellCommonAncestorLevelKernel,
 }};
 
 size_t S2GeogNumKernels(void) { return kSedonaKernels.size(); }
@@ -243,6 +276,78 @@ int S2GeogInitKernels(void* kernels_array, size_t kernels_array_size_bytes,
   return 0;
 }
 
+int S2GeogKernelSetGeographyCache(void* kernel, int format, size_t max_bytes,
+                                  int shared) {
+  S2GEOGRAPHY_C_BEGIN(nullptr);
+  S2GEOGRAPHY_DCHECK(kernel != nullptr);
+  if (format != S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF) {
+    return ENOTSUP;
+  }
+
+  s2geography::sedona_udf::KernelSetGeographyCache(
+      reinterpret_cast<struct SedonaCScalarKernel*>(kernel), max_bytes,
+      shared != 0);
+  return S2GEOGRAPHY_OK;
+  S2GEOGRAPHY_C_END(nullptr);
+}
+
+int S2GeogKernelSetCollectStats(void* kernel, int format, int enabled) {
+  S2GEOGRAPHY_C_BEGIN(nullptr);
+  S2GEOGRAPHY_DCHECK(kernel != nullptr);
+  if (format != S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF) {
+    return ENOTSUP;
+  }
+
+  s2geography::sedona_udf::KernelSetCollectStats(
+      reinterpret_cast<struct SedonaCScalarKernel*>(kernel), enabled != 0);
+  return S2GEOGRAPHY_OK;
+  S2GEOGRAPHY_C_END(nullptr);
+}
+
+static_assert(static_cast<int>(
+                  s2geography::sedona_udf::ExecStrategy::kNumStrategies) ==
+                  S2GEOGRAPHY_NUM_STRATEGIES,
+              "S2GEOGRAPHY_STRATEGY_* out of sync with ExecStrategy");
+
+int S2GeogKernelImplGetStats(void* impl, int format,
+                             struct S2GeogKernelStats* out) {
+  S2GEOGRAPHY_C_BEGIN(nullptr);
+  S2GEOGRAPHY_DCHECK(impl != nullptr);
+  S2GEOGRAPHY_DCHECK(out != nullptr);
+  if (format != S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF) {
+    return ENOTSUP;
+  }
+
+  const s2geography::sedona_udf::ExecStats& stats =
+      s2geography::sedona_udf::KernelImplStats(
+          reinterpret_cast<struct SedonaCScalarKernelImpl*>(impl));
+  out->num_batches = stats.num_batches;
+  out->num_rows = stats.num_rows;
+  out->num_null_rows = stats.num_null_rows;
+  out->num_index_builds = stats.num_index_builds;
+  out->num_bytes_parsed = stats.num_bytes_parsed;
+  out->exec_time_ns = stats.exec_time_ns;
+  for (int i = 0; i < S2GEOGRAPHY_NUM_STRATEGIES; i++) {
+    out->num_strategy[i] = stats.num_strategy[i];
+  }
+
+  return S2GEOGRAPHY_OK;
+  S2GEOGRAPHY_C_END(nullptr);
+}
+
+int S2GeogKernelImplResetStats(void* impl, int format) {
+  S2GEOGRAPHY_C_BEGIN(nullptr);
+  S2GEOGRAPHY_DCHECK(impl != nullptr);
+  if (format != S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF) {
+    return ENOTSUP;
+  }
+
+  s2geography::sedona_udf::KernelImplResetStats(
+      reinterpret_cast<struct SedonaCScalarKernelImpl*>(impl));
+  return S2GEOGRAPHY_OK;
+  S2GEOGRAPHY_C_END(nullptr);
+}
+
 // Geography functions
 
 S2GeogErrorCode S2GeogCreate(struct S2Geog** geog) {
@@ -4,10 +4,13 @@
 #include <gtest/gtest.h>
 #include <s2/s2cell_id.h>
 
+#include <cerrno>
 #include <cstring>
 #include <limits>
 #include <vector>
 
+#include "s2geography/sedona_udf/sedona_extension.h"
+
 // This test file performs "is it plugged in" level checks for all C API
 // functions. The goal is to ensure that:
 // 1. All functions are exported and linkable
@@ -279,7 +282,7 @@ TEST(S2GeographyC, RectBounderBound) {
 // Sedona UDF Interface Tests
 // ============================================================================
 
-TEST(S2GeographyC, NumKernels) { EXPECT_EQ(S2GeogNumKernels(), 29); }
+TEST(S2GeographyC, NumKernels) { EXPECT_EQ(S2GeogNumKernels(), 60); }
 
 TEST(S2GeographyC, InitKernelsInvalidFormat) {
   // Test with invalid format
@@ -291,6 +294,69 @@ TEST(S2GeographyC, InitKernelsInvalidFormat) {
   EXPECT_NE(code, S2GEOGRAPHY_OK);
 }
 
+TEST(S2GeographyC, KernelSetGeographyCache) {
+  size_t num_kernels = S2GeogNumKernels();
+  std::vector<SedonaCScalarKernel> kernels(num_kernels);
+  ASSERT_EQ(S2GeogInitKernels(kernels.data(),
+                              kernels.size() * sizeof(SedonaCScalarKernel),
+                              S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF),
+            S2GEOGRAPHY_OK);
+
+  EXPECT_EQ(S2GeogKernelSetGeographyCache(&kernels[0], 999, 1024, 1), ENOTSUP);
+  EXPECT_EQ(S2GeogKernelSetGeographyCache(&kernels[0],
+                                          S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF,
+                                          1024 * 1024, 1),
+            S2GEOGRAPHY_OK);
+  EXPECT_EQ(S2GeogKernelSetGeographyCache(&kernels[0],
+                                          S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF,
+                                          0, 0),
+            S2GEOGRAPHY_OK);
+
+  for (auto& kernel : kernels) {
+    kernel.release(&kernel);
+  }
+}
+
+TEST(S2GeographyC, KernelStats) {
+  size_t num_kernels = S2GeogNumKernels();
+  std::vector<SedonaCScalarKernel> kernels(num_kernels);
+  ASSERT_EQ(S2GeogInitKernels(kernels.data(),
+                              kernels.size() * sizeof(SedonaCScalarKernel),
+                              S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF),
+            S2GEOGRAPHY_OK);
+
+  EXPECT_EQ(S2GeogKernelSetCollectStats(&kernels[0], 999, 1), ENOTSUP);
+  ASSERT_EQ(S2GeogKernelSetCollectStats(
+                &kernels[0], S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF, 1),
+            S2GEOGRAPHY_OK);
+
+  SedonaCScalarKernelImpl impl;
+  kernels[0].new_impl(&kernels[0], &impl);
+
+  struct S2GeogKernelStats stats;
+  memset(&stats, 0xff, sizeof(stats));
+  EXPECT_EQ(S2GeogKernelImplGetStats(&impl, 999, &stats), ENOTSUP);
+  ASSERT_EQ(S2GeogKernelImplGetStats(
+                &impl, S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF, &stats),
+            S2GEOGRAPHY_OK);
+  EXPECT_EQ(stats.num_batches, 0);
+  EXPECT_EQ(stats.num_rows, 0);
+  EXPECT_EQ(stats.exec_time_ns, 0);
+  for (int i = 0; i < S2GEOGRAPHY_NUM_STRATEGIES; i++) {
+    EXPECT_EQ(stats.num_strategy[i], 0);
+  }
+
+  EXPECT_EQ(S2GeogKernelImplResetStats(&impl, 999), ENOTSUP);
+  EXPECT_EQ(
+      S2GeogKernelImplResetStats(&impl, S2GEOGRAPHY_KERNEL_FORMAT_SEDONA_UDF),
+      S2GEOGRAPHY_OK);
+
+  impl.release(&impl);
+  for (auto& kernel : kernels) {
+    kernel.release(&kernel);
+  }
+}
+
 // ============================================================================
 // Version Functions Tests
 // ============================================================================
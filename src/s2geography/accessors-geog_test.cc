@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "geoarrow/geoarrow.hpp"
 #include "nanoarrow/nanoarrow.hpp"
 #include "s2geography/sedona_udf/sedona_udf_test_internal.h"
@@ -48,6 +50,35 @@ TEST(Accessors, SedonaUdfLengthArray) {
                       {0.0, 111195.10117748393, 0.0, std::nullopt}));
 }
 
+TEST(Accessors, SedonaUdfLengthManyEdges) {
+  // A meridian split into many short edges should have the same length as
+  // the same meridian as a single edge
+  std::string line = "LINESTRING (0 0";
+  for (int i = 1; i <= 10000; i++) {
+    line += ", 0 " + std::to_string(i / 10000.0);
+  }
+  line += ")";
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::LengthKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(
+      TestInitKernel(&kernel, &impl, {ARROW_TYPE_WKB}, NANOARROW_TYPE_DOUBLE));
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(&impl, {ARROW_TYPE_WKB}, {{line}},
+                                            {}, out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_DOUBLE);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), out_array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_NEAR(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 0),
+              111195.10117748393, 1e-3);
+}
+
 TEST(AccessorsGeog, SedonaUdfCentroidArray) {
   struct SedonaCScalarKernel kernel;
   s2geography::sedona_udf::CentroidKernel(&kernel);
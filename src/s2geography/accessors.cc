@@ -3,6 +3,9 @@
 
 #include <s2/s2earth.h>
 
+#include <cmath>
+#include <vector>
+
 #include "s2geography/build.h"
 #include "s2geography/geography_interface.h"
 #include "s2geography/sedona_udf/sedona_udf_internal.h"
@@ -274,19 +277,70 @@ bool s2_find_validation_error(const Geography& geog, S2Error* error) {
 
 namespace sedona_udf {
 
+namespace {
+
+// Neumaier's variant of Kahan summation. Long lines are mostly short edges,
+// and adding many small lengths to a large total loses precision.
+class CompensatedSum {
+ public:
+  void Add(double value) {
+    double total = sum_ + value;
+    if (std::abs(sum_) >= std::abs(value)) {
+      compensation_ += (sum_ - total) + value;
+    } else {
+      compensation_ += (value - total) + sum_;
+    }
+
+    sum_ = total;
+  }
+
+  double value() const { return sum_ + compensation_; }
+
+ private:
+  double sum_{};
+  double compensation_{};
+};
+
+// Add the length in radians of every edge in geom. Each chain's vertices
+// are converted to S2Points once into scratch, and the lengths are then
+// reduced in a tight loop over contiguous memory instead of through the
+// edge visitor.
+void AddEdgeLengths(const GeoArrowGeom& geom, std::vector<S2Point>* scratch,
+                    CompensatedSum* length) {
+  geom.VisitChains([&](GeoArrowChain chain) {
+    if (chain.size() < 2) {
+      return true;
+    }
+
+    scratch->resize(chain.size());
+    S2Point* pts = scratch->data();
+    chain.VisitVertices([&](const S2Point& pt) {
+      *pts++ = pt;
+      return true;
+    });
+
+    pts = scratch->data();
+    for (uint32_t i = 1; i < chain.size(); i++) {
+      length->Add(S1ChordAngle(pts[i - 1], pts[i]).radians());
+    }
+
+    return true;
+  });
+}
+
+}  // namespace
+
 struct S2LengthExec {
   using arg0_t = GeoArrowGeographyInputView;
   using out_t = DoubleOutputBuilder;
 
   void Exec(arg0_t::c_type value, out_t* out) {
-    double length = 0.0;
-    value.lines()->geom().VisitEdges([&](const S2Shape::Edge& e) {
-      length += S1ChordAngle(e.v0, e.v1).radians();
-      return true;
-    });
-
-    out->Append(length * S2Earth::RadiusMeters());
+    CompensatedSum length;
+    AddEdgeLengths(value.lines()->geom(), &scratch_, &length);
+    out->Append(length.value() * S2Earth::RadiusMeters());
   }
+
+  std::vector<S2Point> scratch_;
 };
 
 struct S2AreaExec {
@@ -294,13 +348,14 @@ struct S2AreaExec {
   using out_t = DoubleOutputBuilder;
 
   void Exec(arg0_t::c_type value, out_t* out) {
-    double area = 0.0;
+    CompensatedSum area;
     value.polygons()->geom().VisitLoops(&scratch_, [&](GeoArrowLoop loop) {
-      area += loop.GetSignedArea();
+      area.Add(loop.GetSignedArea());
       return true;
     });
 
-    out->Append(area * S2Earth::RadiusMeters() * S2Earth::RadiusMeters());
+    out->Append(area.value() * S2Earth::RadiusMeters() *
+                S2Earth::RadiusMeters());
   }
 
   std::vector<S2Point> scratch_;
@@ -311,14 +366,12 @@ struct S2PerimeterExec {
   using out_t = DoubleOutputBuilder;
 
   void Exec(arg0_t::c_type value, out_t* out) {
-    double perimeter = 0.0;
-    value.polygons()->geom().VisitEdges([&](const S2Shape::Edge& e) {
-      perimeter += S1ChordAngle(e.v0, e.v1).radians();
-      return true;
-    });
-
-    out->Append(perimeter * S2Earth::RadiusMeters());
+    CompensatedSum perimeter;
+    AddEdgeLengths(value.polygons()->geom(), &scratch_, &perimeter);
+    out->Append(perimeter.value() * S2Earth::RadiusMeters());
   }
+
+  std::vector<S2Point> scratch_;
 };
 
 void LengthKernel(struct SedonaCScalarKernel* out) {
@@ -1,6 +1,8 @@
 
 #include "s2geography/build.h"
 
+#include <s2/mutable_s2shape_index.h>
+#include <s2/r2rect.h>
 #include <s2/s2boolean_operation.h>
 #include <s2/s2buffer_operation.h>
 #include <s2/s2builder.h>
@@ -9,15 +11,29 @@
 #include <s2/s2builderutil_s2polygon_layer.h>
 #include <s2/s2builderutil_s2polyline_vector_layer.h>
 #include <s2/s2builderutil_snap_functions.h>
+#include <s2/s2cell.h>
+#include <s2/s2cell_union.h>
+#include <s2/s2contains_point_query.h>
+#include <s2/s2coords.h>
+#include <s2/s2crossing_edge_query.h>
 #include <s2/s2earth.h>
+#include <s2/s2edge_distances.h>
+#include <s2/s2edge_crossings.h>
 #include <s2/s2loop.h>
+#include <s2/s2region_coverer.h>
+#include <s2/s2shape_index_region.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
 #include <cmath>
+#include <exception>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 
 #include "s2geography/accessors.h"
 #include "s2geography/geography_interface.h"
@@ -154,6 +170,300 @@ std::unique_ptr<Geography> s2_boolean_operation(
       options.polygon_layer_action, options.polygon_layer_action);
 }
 
+namespace {
+
+// Call func(i) for i in [0, n) using up to num_threads threads (or one per
+// hardware thread if num_threads is zero or negative), including the calling
+// thread. The first exception thrown by func is rethrown on the calling
+// thread after all threads have finished.
+template <typename Func>
+void ParallelFor(int n, int num_threads, Func&& func) {
+  if (num_threads <= 0) {
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  num_threads = std::max(1, std::min(num_threads, n));
+
+  std::atomic<int> next{0};
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto work = [&](int thread_id) {
+    try {
+      for (int i = next++; i < n; i = next++) {
+        func(i);
+      }
+    } catch (...) {
+      errors[thread_id] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(work, i);
+  }
+  work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+bool HasOnlyPolygons(const S2ShapeIndex& index) {
+  for (int i = 0; i < index.num_shape_ids(); ++i) {
+    const S2Shape* shape = index.shape(i);
+    if (shape != nullptr && shape->dimension() != 2) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::unique_ptr<S2Polygon> s2_polygon_operation(
+    const S2ShapeIndex& geog1, const S2ShapeIndex& geog2,
+    S2BooleanOperation::OpType op_type,
+    const S2BooleanOperation::Options& options) {
+  auto polygon = absl::make_unique<S2Polygon>();
+  S2BooleanOperation op(
+      op_type, absl::make_unique<s2builderutil::S2PolygonLayer>(polygon.get()),
+      options);
+
+  S2Error error;
+  if (!op.Build(geog1, geog2, &error)) {
+    std::stringstream ss;
+    ss << error;
+    throw Exception(ss.str());
+  }
+
+  return polygon;
+}
+
+// The region used to clip input that was already clipped to parent (or
+// S2CellId::None() for input that was not clipped) to cell_id. Sides of
+// cell_id on the boundary of parent are pushed outward so that only the
+// boundaries between cells below parent are clipped here. Each crossing of an
+// input edge with a cell boundary is then computed once, from the same edge
+// for both cells that share the boundary, and the pieces still line up
+// exactly when stitched back together.
+std::unique_ptr<S2Polygon> PartitionClipRegion(S2CellId cell_id,
+                                               S2CellId parent) {
+  S2Cell cell(cell_id);
+  if (parent == S2CellId::None()) {
+    return absl::make_unique<S2Polygon>(cell);
+  }
+
+  R2Rect bound = cell.GetBoundUV();
+  R2Rect parent_bound = S2Cell(parent).GetBoundUV();
+  R1Interval u = bound.x();
+  R1Interval v = bound.y();
+  R2Rect region(
+      R1Interval(
+          u.lo() == parent_bound.x().lo() ? u.lo() - u.GetLength() : u.lo(),
+          u.hi() == parent_bound.x().hi() ? u.hi() + u.GetLength() : u.hi()),
+      R1Interval(
+          v.lo() == parent_bound.y().lo() ? v.lo() - v.GetLength() : v.lo(),
+          v.hi() == parent_bound.y().hi() ? v.hi() + v.GetLength() : v.hi()));
+
+  std::vector<S2Point> vertices;
+  for (int k = 0; k < 4; ++k) {
+    vertices.push_back(
+        S2::FaceUVtoXYZ(cell.face(), region.GetVertex(k)).Normalize());
+  }
+
+  return absl::make_unique<S2Polygon>(absl::make_unique<S2Loop>(vertices));
+}
+
+// Both inputs of a partitioned operation clipped to a cell, which are shared
+// by all of the tasks below that cell
+struct PartitionClippedInputs {
+  std::unique_ptr<S2Polygon> polygon1;
+  std::unique_ptr<S2Polygon> polygon2;
+  MutableS2ShapeIndex index1;
+  MutableS2ShapeIndex index2;
+};
+
+// The cells [begin, end) of a partition below parent, with the inputs as
+// clipped to parent (or the original inputs if parent is S2CellId::None())
+struct PartitionTask {
+  const S2ShapeIndex* index1;
+  const S2ShapeIndex* index2;
+  std::shared_ptr<PartitionClippedInputs> clipped;
+  S2CellId parent;
+  int begin;
+  int end;
+};
+
+std::shared_ptr<PartitionClippedInputs> ClipPartitionInputs(
+    const PartitionTask& task, S2CellId cell_id) {
+  std::unique_ptr<S2Polygon> region =
+      PartitionClipRegion(cell_id, task.parent);
+  MutableS2ShapeIndex region_index;
+  region_index.Add(absl::make_unique<S2Polygon::Shape>(region.get()));
+
+  auto clipped = std::make_shared<PartitionClippedInputs>();
+  S2BooleanOperation::Options clip_options;
+  clipped->polygon1 = s2_polygon_operation(
+      *task.index1, region_index, S2BooleanOperation::OpType::INTERSECTION,
+      clip_options);
+  clipped->polygon2 = s2_polygon_operation(
+      *task.index2, region_index, S2BooleanOperation::OpType::INTERSECTION,
+      clip_options);
+  clipped->index1.Add(
+      absl::make_unique<S2Polygon::Shape>(clipped->polygon1.get()));
+  clipped->index2.Add(
+      absl::make_unique<S2Polygon::Shape>(clipped->polygon2.get()));
+  return clipped;
+}
+
+// Compute the piece of the output for a task with a single cell or clip the
+// inputs to the smallest cell containing all of the task's cells and split
+// it into one task per child of that cell (or per face). Each level of
+// tasks only reads the (much smaller) inputs clipped by the level above it.
+void ExpandPartitionTask(const PartitionTask& task,
+                         S2BooleanOperation::OpType op_type,
+                         const S2BooleanOperation::Options& options,
+                         const S2CellUnion& cells,
+                         std::vector<std::unique_ptr<S2Polygon>>* pieces,
+                         std::vector<PartitionTask>* next) {
+  S2CellId first = cells.cell_id(task.begin);
+  if (task.end - task.begin == 1) {
+    std::shared_ptr<PartitionClippedInputs> clipped =
+        ClipPartitionInputs(task, first);
+    (*pieces)[task.begin] = s2_polygon_operation(
+        clipped->index1, clipped->index2, op_type, options);
+    return;
+  }
+
+  PartitionTask split = task;
+  int level = first.GetCommonAncestorLevel(cells.cell_id(task.end - 1));
+  if (level >= 0 && first.parent(level) != task.parent) {
+    split.parent = first.parent(level);
+    split.clipped = ClipPartitionInputs(task, split.parent);
+    split.index1 = &split.clipped->index1;
+    split.index2 = &split.clipped->index2;
+
+    // Every operation on two empty inputs is empty
+    if (split.clipped->polygon1->is_empty() &&
+        split.clipped->polygon2->is_empty()) {
+      for (int i = task.begin; i < task.end; ++i) {
+        (*pieces)[i] = absl::make_unique<S2Polygon>();
+      }
+      return;
+    }
+  }
+
+  // Cells are sorted, so the cells within each child (or face) are
+  // contiguous. The task's cells are all below level, so there are at least
+  // two children.
+  int begin = task.begin;
+  while (begin < task.end) {
+    S2CellId child = cells.cell_id(begin).parent(level + 1);
+    int end = begin + 1;
+    while (end < task.end && child.contains(cells.cell_id(end))) {
+      ++end;
+    }
+
+    PartitionTask child_task = split;
+    child_task.begin = begin;
+    child_task.end = end;
+    next->push_back(std::move(child_task));
+    begin = end;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<Geography> s2_boolean_operation_partitioned(
+    const S2ShapeIndex& geog1, const S2ShapeIndex& geog2,
+    S2BooleanOperation::OpType op_type, const GlobalOptions& options,
+    int max_cells, int num_threads) {
+  if (!HasOnlyPolygons(geog1) || !HasOnlyPolygons(geog2)) {
+    return s2_boolean_operation(geog1, geog2, op_type, options);
+  }
+
+  // Partition the space covered by the output. Each partition is a cell such
+  // that partitions never overlap.
+  S2RegionCoverer::Options coverer_options;
+  coverer_options.set_max_cells(std::max(max_cells, 1));
+  S2RegionCoverer coverer(coverer_options);
+  S2CellUnion covering1 = coverer.GetCovering(MakeS2ShapeIndexRegion(&geog1));
+  S2CellUnion covering2 = coverer.GetCovering(MakeS2ShapeIndexRegion(&geog2));
+
+  S2CellUnion cells;
+  switch (op_type) {
+    case S2BooleanOperation::OpType::INTERSECTION:
+      cells = covering1.Intersection(covering2);
+      break;
+    case S2BooleanOperation::OpType::DIFFERENCE:
+      cells = std::move(covering1);
+      break;
+    default:
+      cells = covering1.Union(covering2);
+      break;
+  }
+
+  // Compute the output within each cell, clipping the inputs down the cell
+  // hierarchy such that no cell is clipped from the whole input. Tasks at
+  // the same depth are computed in parallel.
+  std::vector<std::unique_ptr<S2Polygon>> pieces(cells.size());
+  std::vector<PartitionTask> tasks;
+  if (cells.num_cells() > 0) {
+    tasks.push_back(
+        {&geog1, &geog2, nullptr, S2CellId::None(), 0, cells.num_cells()});
+  }
+
+  while (!tasks.empty()) {
+    std::vector<std::vector<PartitionTask>> next(tasks.size());
+    ParallelFor(static_cast<int>(tasks.size()), num_threads, [&](int i) {
+      ExpandPartitionTask(tasks[i], op_type, options.boolean_operation, cells,
+                          &pieces, &next[i]);
+    });
+
+    tasks.clear();
+    for (auto& child_tasks : next) {
+      for (auto& child_task : child_tasks) {
+        tasks.push_back(std::move(child_task));
+      }
+    }
+  }
+
+  // Stitch the pieces back together. Boundaries shared by adjacent pieces
+  // are sibling pairs that cancel; the merge radius absorbs differences in
+  // how the crossing of an edge with a shared cell boundary was computed on
+  // either side. A result without any edges is either empty or full, which
+  // only the area of the pieces can tell apart.
+  double area = 0;
+  for (const auto& piece : pieces) {
+    area += piece->GetArea();
+  }
+
+  auto polygon = absl::make_unique<S2Polygon>();
+  S2Builder builder{S2Builder::Options(
+      s2builderutil::IdentitySnapFunction(S2::kIntersectionMergeRadius))};
+  builder.StartLayer(
+      absl::make_unique<s2builderutil::S2PolygonLayer>(polygon.get()));
+  builder.AddIsFullPolygonPredicate(
+      [area](const S2Builder::Graph&, S2Error*) { return area > 2 * M_PI; });
+  for (const auto& piece : pieces) {
+    builder.AddPolygon(*piece);
+  }
+
+  S2Error error;
+  if (!builder.Build(&error)) {
+    std::stringstream ss;
+    ss << error;
+    throw Exception(ss.str());
+  }
+
+  return s2_geography_from_layers({}, {}, std::move(polygon),
+                                  options.point_layer_action,
+                                  options.polyline_layer_action,
+                                  options.polygon_layer_action);
+}
+
 std::unique_ptr<PolygonGeography> s2_unary_union(const PolygonGeography& geog,
                                                  const GlobalOptions& options) {
   // A geography with invalid loops won't work with the S2BooleanOperation
@@ -363,17 +673,142 @@ std::unique_ptr<PolygonGeography> s2_build_polygon(const Geography& geog) {
   }
 }
 
+S2BufferAggregator::S2BufferAggregator(
+    const S2BufferOperation::Options& options)
+    : polygon_(absl::make_unique<S2Polygon>()),
+      op_(absl::make_unique<S2BufferOperation>(
+          absl::make_unique<s2builderutil::S2PolygonLayer>(polygon_.get()),
+          options)) {}
+
+void S2BufferAggregator::Add(const Geography& geog) {
+  CheckNotFinalized();
+  for (int i = 0; i < geog.num_shapes(); i++) {
+    std::unique_ptr<S2Shape> shape = geog.Shape(i);
+
+    // AddShape doesn't handle dimension-0 shapes (points)
+    if (shape->dimension() == 0) {
+      for (int j = 0; j < shape->num_edges(); j++) {
+        op_->AddPoint(shape->edge(j).v0);
+      }
+    } else {
+      op_->AddShape(*shape);
+    }
+  }
+}
+
+void S2BufferAggregator::Merge(S2BufferAggregator&& other) {
+  CheckNotFinalized();
+  partials_.push_back(other.Build());
+  for (auto& partial : other.partials_) {
+    partials_.push_back(std::move(partial));
+  }
+  other.partials_.clear();
+}
+
+void S2BufferAggregator::CheckNotFinalized() const {
+  if (!op_) {
+    throw Exception(
+        "S2BufferAggregator can't be used after Finalize() or Merge()");
+  }
+}
+
+std::unique_ptr<S2Polygon> S2BufferAggregator::Build() {
+  CheckNotFinalized();
+  S2Error error;
+  if (!op_->Build(&error)) {
+    std::stringstream ss;
+    ss << error;
+    throw Exception(ss.str());
+  }
+
+  // The operation writes into polygon_ and can't be built again
+  op_.reset();
+  return std::move(polygon_);
+}
+
+std::unique_ptr<Geography> S2BufferAggregator::Finalize() {
+  std::unique_ptr<S2Polygon> polygon = Build();
+  if (!partials_.empty()) {
+    partials_.push_back(std::move(polygon));
+    polygon = S2Polygon::DestructiveUnion(std::move(partials_));
+    partials_.clear();
+  }
+
+  return absl::make_unique<PolygonGeography>(std::move(polygon));
+}
+
 void RebuildAggregator::Add(const Geography& geog) { index_.Add(geog); }
 
 std::unique_ptr<Geography> RebuildAggregator::Finalize() {
   return s2_rebuild(index_, options_);
 }
 
-void S2CoverageUnionAggregator::Add(const Geography& geog) { index_.Add(geog); }
+S2CoverageUnionAggregator::S2CoverageUnionAggregator(
+    const GlobalOptions& options, int group_level, int num_threads)
+    : options_(options), group_level_(group_level), num_threads_(num_threads) {
+  if (group_level < 0 || group_level > S2CellId::kMaxLevel) {
+    throw Exception("Invalid S2CoverageUnionAggregator group level: " +
+                    std::to_string(group_level));
+  }
+}
+
+void S2CoverageUnionAggregator::Add(const Geography& geog) {
+  if (group_level_ < 0) {
+    index_.Add(geog);
+    return;
+  }
+
+  S2LatLngRect bounds = geog.Region()->GetRectBound();
+  S2CellId group = bounds.is_empty()
+                       ? S2CellId::Begin(group_level_)
+                       : S2CellId(bounds.GetCenter()).parent(group_level_);
+  grouped_.emplace_back(group, &geog);
+}
 
 std::unique_ptr<Geography> S2CoverageUnionAggregator::Finalize() {
   ShapeIndexGeography empty_index_;
-  return s2_boolean_operation(index_, empty_index_,
+  if (group_level_ < 0) {
+    return s2_boolean_operation(index_, empty_index_,
+                                S2BooleanOperation::OpType::UNION, options_);
+  }
+
+  std::stable_sort(
+      grouped_.begin(), grouped_.end(),
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+  std::vector<size_t> group_starts;
+  for (size_t i = 0; i < grouped_.size(); ++i) {
+    if (i == 0 || grouped_[i].first != grouped_[i - 1].first) {
+      group_starts.push_back(i);
+    }
+  }
+  group_starts.push_back(grouped_.size());
+
+  // Dissolve each group independently. Group outputs only touch along the
+  // boundaries between groups, which are removed by the final union.
+  int num_groups = static_cast<int>(group_starts.size()) - 1;
+  std::vector<std::unique_ptr<Geography>> dissolved(num_groups);
+  ParallelFor(num_groups, num_threads_, [&](int i) {
+    ShapeIndexGeography group_index;
+    for (size_t j = group_starts[i]; j < group_starts[i + 1]; ++j) {
+      group_index.Add(*grouped_[j].second);
+    }
+
+    ShapeIndexGeography empty_group_index;
+    dissolved[i] =
+        s2_boolean_operation(group_index, empty_group_index,
+                             S2BooleanOperation::OpType::UNION, options_);
+  });
+
+  if (num_groups == 1) {
+    return std::move(dissolved[0]);
+  }
+
+  ShapeIndexGeography merged_index;
+  for (const auto& geog : dissolved) {
+    merged_index.Add(*geog);
+  }
+
+  return s2_boolean_operation(merged_index, empty_index_,
                               S2BooleanOperation::OpType::UNION, options_);
 }
 
@@ -576,6 +1011,48 @@ struct OutputGeometry {
     ring_offsets_.push_back(static_cast<int>(polygon_vertices_.size()));
   }
 
+  /// \brief Add the vertices of a shape according to its dimension
+  ///
+  /// Polygon chains must be oriented with the interior on the left (e.g., as
+  /// exposed by S2Polygon::Shape) such that nesting can be computed from
+  /// ring orientation. Only longitude and latitude are written.
+  void AddShape(const S2Shape& shape) {
+    internal::GeoArrowVertex vt;
+    for (int i = 0; i < shape.num_chains(); ++i) {
+      S2Shape::Chain chain = shape.chain(i);
+      if (chain.length == 0) {
+        continue;
+      }
+
+      switch (shape.dimension()) {
+        case 0:
+          for (int j = 0; j < chain.length; ++j) {
+            vt.SetPoint(shape.chain_edge(i, j).v0);
+            AddPoint(vt);
+          }
+          break;
+        case 1:
+          vt.SetPoint(shape.chain_edge(i, 0).v0);
+          AddLineVertex(vt);
+          for (int j = 0; j < chain.length; ++j) {
+            vt.SetPoint(shape.chain_edge(i, j).v1);
+            AddLineVertex(vt);
+          }
+          FinishLine();
+          break;
+        default:
+          vt.SetPoint(shape.chain_edge(i, 0).v0);
+          AddRingVertex(vt);
+          for (int j = 0; j < chain.length; ++j) {
+            vt.SetPoint(shape.chain_edge(i, j).v1);
+            AddRingVertex(vt);
+          }
+          FinishRing();
+          break;
+      }
+    }
+  }
+
   void AddGeography(const GeoArrowGeography& geog) {
     geog.points()->geom().VisitNativeVertices([&](internal::GeoArrowVertex v) {
       AddPoint(v.Normalize(geog.points()->dimensions()));
@@ -624,6 +1101,17 @@ struct OutputGeometry {
   /// \brief Return true of any rings were added to the output
   bool has_polygons() const { return ring_offsets_.size() > 1; }
 
+  /// \brief Return the number of rings added to the output
+  int num_rings() const { return static_cast<int>(ring_offsets_.size()) - 1; }
+
+  /// \brief Visit the vertices of a ring in the order they were added
+  template <typename Visit>
+  void VisitRingVertices(int i, Visit&& visit) const {
+    for (int j = ring_offsets_[i]; j < ring_offsets_[i + 1]; ++j) {
+      visit(polygon_vertices_[j]);
+    }
+  }
+
   /// \brief Return the number of output geometry dimensions
   int num_types() const { return has_points() + has_lines() + has_polygons(); }
 
@@ -643,7 +1131,10 @@ struct OutputGeometry {
   /// - More than one of the above is written as a GEOMETRYCOLLECTION
   ///
   /// This is the point at which the nesting of any output polygon rings are
-  /// calculated.
+  /// calculated. Rather than visiting each coordinate, the output is described
+  /// as a GeoArrowGeometryView whose sequences point into the buffered
+  /// vertices such that the builder can copy them into its WKB output
+  /// directly.
   void WriteTo(GeoArrowOutputBuilder* out,
                uint8_t geometry_type_if_empty =
                    GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION) {
@@ -652,92 +1143,116 @@ struct OutputGeometry {
       return;
     }
 
-    if (num_types() == 1) {
-      out->FeatureStart();
-      if (has_points()) WritePointOutput(out);
-      if (has_lines()) WriteLinesOutput(out);
-      if (has_polygons()) WritePolygonOutput(out);
-      out->FeatureEnd();
-      return;
+    SetDimensions(out->dimensions());
+    nodes_.clear();
+
+    uint8_t level = 0;
+    if (num_types() > 1) {
+      AppendNode(GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION, num_types(), level);
+      ++level;
     }
 
-    out->FeatureStart();
-    out->GeomStart(GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION);
-    if (has_points()) WritePointOutput(out);
-    if (has_lines()) WriteLinesOutput(out);
-    if (has_polygons()) WritePolygonOutput(out);
-    out->GeomEnd();
-    out->FeatureEnd();
+    if (has_points()) AppendPointNodes(level);
+    if (has_lines()) AppendLineNodes(level);
+    if (has_polygons()) AppendPolygonNodes(level);
+
+    out->AppendGeometry({nodes_.data(), static_cast<int64_t>(nodes_.size())});
   }
 
  private:
-  void WritePointOutput(GeoArrowOutputBuilder* out) {
+  // Nodes point directly into buffered vertices, which are always stored
+  // as interleaved xyzm
+  static_assert(sizeof(internal::GeoArrowVertex) == 4 * sizeof(double),
+                "GeoArrowVertex must be four interleaved doubles");
+
+  void SetDimensions(uint8_t dimensions) {
+    dimensions_ = dimensions;
+    // Map output dimensions onto the (normalized) xyzm vertex. The values
+    // beyond the output dimensions are never read but still point to valid
+    // memory.
+    if (dimensions == GEOARROW_DIMENSIONS_XYM) {
+      coord_offsets_ = {0, 1, 3, 2};
+    } else {
+      coord_offsets_ = {0, 1, 2, 3};
+    }
+  }
+
+  void AppendNode(uint8_t geometry_type, uint32_t size, uint8_t level) {
+    struct GeoArrowGeometryNode node{};
+    node.geometry_type = geometry_type;
+    node.dimensions = dimensions_;
+    node.size = size;
+    node.level = level;
+    for (int i = 0; i < 4; ++i) {
+      node.coords[i] = reinterpret_cast<const uint8_t*>(&kNaN);
+    }
+
+    nodes_.push_back(node);
+  }
+
+  void AppendSequenceNode(uint8_t geometry_type,
+                          const internal::GeoArrowVertex* vertices,
+                          uint32_t size, uint8_t level) {
+    AppendNode(geometry_type, size, level);
+    struct GeoArrowGeometryNode& node = nodes_.back();
+    const uint8_t* base = reinterpret_cast<const uint8_t*>(vertices);
+    for (int i = 0; i < 4; ++i) {
+      node.coords[i] = base + coord_offsets_[i] * sizeof(double);
+      node.coord_stride[i] = sizeof(internal::GeoArrowVertex);
+    }
+  }
+
+  void AppendPointNodes(uint8_t level) {
     if (points_.size() == 1) {
-      out->GeomStart(GEOARROW_GEOMETRY_TYPE_POINT);
-      out->WriteCoord(points_[0]);
-      out->GeomEnd();
-    } else if (points_.size() > 1) {
-      out->GeomStart(GEOARROW_GEOMETRY_TYPE_MULTIPOINT);
-      for (const auto& pt : points_) {
-        out->GeomStart(GEOARROW_GEOMETRY_TYPE_POINT);
-        out->WriteCoord(pt);
-        out->GeomEnd();
-      }
-      out->GeomEnd();
+      AppendSequenceNode(GEOARROW_GEOMETRY_TYPE_POINT, points_.data(), 1,
+                         level);
+      return;
+    }
+
+    AppendNode(GEOARROW_GEOMETRY_TYPE_MULTIPOINT,
+               static_cast<uint32_t>(points_.size()), level);
+    for (const auto& pt : points_) {
+      AppendSequenceNode(GEOARROW_GEOMETRY_TYPE_POINT, &pt, 1, level + 1);
     }
   }
 
-  void WriteLinesOutput(GeoArrowOutputBuilder* out) {
+  void AppendLineNodes(uint8_t level) {
     if (line_lengths_.size() == 1) {
-      out->GeomStart(GEOARROW_GEOMETRY_TYPE_LINESTRING);
-      for (int i = 0; i < line_lengths_[0]; ++i) {
-        out->WriteCoord(line_vertices_[i]);
-      }
-      out->GeomEnd();
-    } else if (line_lengths_.size() > 1) {
-      out->GeomStart(GEOARROW_GEOMETRY_TYPE_MULTILINESTRING);
-      int line_vertex_id = 0;
-      for (int line_length : line_lengths_) {
-        out->GeomStart(GEOARROW_GEOMETRY_TYPE_LINESTRING);
-        for (int i = 0; i < line_length; ++i) {
-          out->WriteCoord(line_vertices_[line_vertex_id++]);
-        }
-        out->GeomEnd();
-      }
-      out->GeomEnd();
+      AppendSequenceNode(GEOARROW_GEOMETRY_TYPE_LINESTRING,
+                         line_vertices_.data(), line_lengths_[0], level);
+      return;
+    }
+
+    AppendNode(GEOARROW_GEOMETRY_TYPE_MULTILINESTRING,
+               static_cast<uint32_t>(line_lengths_.size()), level);
+    int line_vertex_id = 0;
+    for (int line_length : line_lengths_) {
+      AppendSequenceNode(GEOARROW_GEOMETRY_TYPE_LINESTRING,
+                         line_vertices_.data() + line_vertex_id, line_length,
+                         level + 1);
+      line_vertex_id += line_length;
     }
   }
 
-  void WritePolygonOutput(GeoArrowOutputBuilder* out) {
+  void AppendPolygonNodes(uint8_t level) {
     GroupRings();
 
+    if (polygon_lengths_.size() > 1) {
+      AppendNode(GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON,
+                 static_cast<uint32_t>(polygon_lengths_.size()), level);
+      ++level;
+    }
+
     int order_id = 0;
-    if (polygon_lengths_.size() == 1) {
-      out->GeomStart(GEOARROW_GEOMETRY_TYPE_POLYGON);
-      for (int r = 0; r < polygon_lengths_[0]; ++r) {
+    for (int polygon_length : polygon_lengths_) {
+      AppendNode(GEOARROW_GEOMETRY_TYPE_POLYGON, polygon_length, level);
+      for (int r = 0; r < polygon_length; ++r) {
         int ri = ring_order_[order_id++];
-        out->RingStart();
-        for (int i = ring_offsets_[ri]; i < ring_offsets_[ri + 1]; ++i) {
-          out->WriteCoord(polygon_vertices_[i]);
-        }
-        out->RingEnd();
-      }
-      out->GeomEnd();
-    } else if (polygon_lengths_.size() > 1) {
-      out->GeomStart(GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON);
-      for (int polygon_length : polygon_lengths_) {
-        out->GeomStart(GEOARROW_GEOMETRY_TYPE_POLYGON);
-        for (int r = 0; r < polygon_length; ++r) {
-          int ri = ring_order_[order_id++];
-          out->RingStart();
-          for (int i = ring_offsets_[ri]; i < ring_offsets_[ri + 1]; ++i) {
-            out->WriteCoord(polygon_vertices_[i]);
-          }
-          out->RingEnd();
-        }
-        out->GeomEnd();
+        AppendSequenceNode(GEOARROW_GEOMETRY_TYPE_LINESTRING,
+                           polygon_vertices_.data() + ring_offsets_[ri],
+                           ring_offsets_[ri + 1] - ring_offsets_[ri],
+                           level + 1);
       }
-      out->GeomEnd();
     }
   }
 
@@ -890,6 +1405,10 @@ struct OutputGeometry {
   std::vector<struct GeoArrowGeometryNode> ring_nodes_;
   std::vector<double> ring_signed_areas_;
   std::vector<S2Point> scratch_;
+  std::vector<struct GeoArrowGeometryNode> nodes_;
+  std::array<int, 4> coord_offsets_{0, 1, 2, 3};
+  uint8_t dimensions_{GEOARROW_DIMENSIONS_XY};
+  static constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
 };
 
 // Common utilities for building output from the edge tracker and the
@@ -914,6 +1433,19 @@ void PopulateVertex(const S2Builder::Graph& g, const EdgeTracker& tracker,
   }
 }
 
+/// \brief Populate a vertex from a single input edge of the EdgeTracker
+///
+/// This is the equivalent of the above for output that was snapped without
+/// the S2Builder (i.e., where each output vertex has exactly one known input
+/// edge).
+void PopulateVertex(const EdgeTracker& tracker, int input_edge_id,
+                    const S2Point& v, internal::GeoArrowVertex* vt) {
+  *vt = tracker.ResolveEdge(input_edge_id).Interpolate(v);
+  if (vt->ToPoint() != v) {
+    vt->SetPoint(v);
+  }
+}
+
 template <typename Visit>
 void VisitTrackedVertices(const S2Builder::Graph& g, const EdgeTracker& tracker,
                           const std::vector<int>& edge_loop, Visit&& visit) {
@@ -1105,6 +1637,69 @@ class GeoArrowPolygonLayer : public S2Builder::Layer {
   std::vector<Graph::EdgeLoop> edge_loops_;
 };
 
+/// \brief Output layer that forwards to a layer owned elsewhere
+///
+/// The S2Builder (and the operations built on it) take ownership of their
+/// layers and destroy them after every Build(). Kernels keep a
+/// GeoArrowPolygonLayer (whose loop vector is reused by every Build()) for
+/// the lifetime of the kernel and hand the builder one of these for each
+/// row instead. The point and polyline layers keep no scratch space between
+/// builds and are created for each row as usual.
+class LayerRef : public S2Builder::Layer {
+ public:
+  explicit LayerRef(S2Builder::Layer* layer) : layer_(layer) {}
+
+  S2Builder::GraphOptions graph_options() const override {
+    return layer_->graph_options();
+  }
+
+  void Build(const S2Builder::Graph& g, S2Error* error) override {
+    layer_->Build(g, error);
+  }
+
+ private:
+  S2Builder::Layer* layer_;
+};
+
+/// \brief Small most recently used cache of state derived from parameters
+///
+/// Kernels whose parameters are usually scalars but may vary per row (e.g.,
+/// a buffer distance that depends on road class) keep the state derived
+/// from a handful of recently used parameter values such that alternating
+/// between them does not rebuild that state for every row. Lookups are
+/// linear, which is cheaper than hashing for this number of entries.
+/// Pointers to values remain valid until the value is evicted.
+template <typename Key, typename Value, size_t kCapacity = 8>
+class ParamCache {
+ public:
+  /// \brief Return the value cached for key (or nullptr if there is none)
+  Value* Find(const Key& key) {
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (entries_[i].first == key) {
+        std::rotate(entries_.begin(), entries_.begin() + i,
+                    entries_.begin() + i + 1);
+        return entries_.front().second.get();
+      }
+    }
+
+    return nullptr;
+  }
+
+  /// \brief Cache a value for key, evicting the least recently used value
+  /// if this cache is full
+  Value* Insert(Key key, std::unique_ptr<Value> value) {
+    if (entries_.size() == kCapacity) {
+      entries_.pop_back();
+    }
+
+    entries_.emplace(entries_.begin(), std::move(key), std::move(value));
+    return entries_.front().second.get();
+  }
+
+ private:
+  std::vector<std::pair<Key, std::unique_ptr<Value>>> entries_;
+};
+
 /// \brief A helper Exec for ReducePrecision and Simplify, which both are a
 /// version of adding input to the builder and rebuilding the output.
 struct RebuildExec {
@@ -1113,7 +1708,15 @@ struct RebuildExec {
     builder_.Init(builder_options_);
   }
 
+  // Layers point to members of this object
+  RebuildExec(const RebuildExec&) = delete;
+  RebuildExec& operator=(const RebuildExec&) = delete;
+
   void Exec(const GeoArrowGeography& value0, GeoArrowOutputBuilder* out) {
+    if (ExecSimple(value0, out)) {
+      return;
+    }
+
     builder_.Reset();
     edge_tracker_.Clear();
     output_.Clear();
@@ -1136,8 +1739,7 @@ struct RebuildExec {
     builder_.AddShape(*value0.lines());
 
     // Start a layer that collects polygon vertices
-    builder_.StartLayer(
-        absl::make_unique<GeoArrowPolygonLayer>(&output_, &edge_tracker_));
+    builder_.StartLayer(absl::make_unique<LayerRef>(&polygon_layer_));
 
     edge_tracker_.Add(value0.polygons());
     builder_.AddShape(*value0.polygons());
@@ -1156,10 +1758,120 @@ struct RebuildExec {
     output_.WriteTo(out, value0.geometry_type());
   }
 
+  /// \brief Snap a single point or short linestring without the S2Builder
+  ///
+  /// A single point snaps to exactly one site. A single linestring whose
+  /// snapped vertices (sites) are far enough apart from each other and from
+  /// every edge they are not part of also snaps vertex by vertex: each input
+  /// vertex snaps to its own site and no edge passes close enough to another
+  /// site to be rerouted through it. Returns false (i.e., the builder is
+  /// required) for any other input or if snapping might change the topology.
+  bool ExecSimple(const GeoArrowGeography& value0, GeoArrowOutputBuilder* out) {
+    const S2Shape* points = value0.points();
+    const S2Shape* lines = value0.lines();
+    const S2Shape* polygons = value0.polygons();
+    if (polygons->num_edges() != 0) {
+      return false;
+    }
+
+    const s2builderutil::SnapFunction& snap = builder_options_.snap_function();
+    sites_.clear();
+    if (points->num_edges() == 1 && lines->num_edges() == 0) {
+      value0.points()->geom().VisitVertices([&](const S2Point& v) {
+        sites_.push_back(snap.SnapPoint(v));
+        return true;
+      });
+    } else if (points->num_edges() == 0 && lines->num_chains() == 1) {
+      // Simplifying edge chains can remove vertices from anything but a
+      // single edge
+      int num_edges = lines->num_edges();
+      int max_edges =
+          builder_options_.simplify_edge_chains() ? 1 : kMaxSimpleEdges;
+      if (num_edges == 0 || num_edges > max_edges) {
+        return false;
+      }
+
+      sites_.push_back(snap.SnapPoint(lines->edge(0).v0));
+      for (int i = 0; i < num_edges; ++i) {
+        sites_.push_back(snap.SnapPoint(lines->edge(i).v1));
+      }
+
+      if (!SitesAreSeparated(*lines)) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+
+    edge_tracker_.Clear();
+    output_.Clear();
+    edge_tracker_.Add(points);
+    edge_tracker_.Add(lines);
+    edge_tracker_.Add(polygons);
+
+    internal::GeoArrowVertex vt;
+    if (sites_.size() == 1) {
+      PopulateVertex(edge_tracker_, 0, sites_[0], &vt);
+      output_.AddPoint(vt);
+    } else {
+      PopulateVertex(edge_tracker_, 0, sites_[0], &vt);
+      output_.AddLineVertex(vt);
+      for (size_t i = 1; i < sites_.size(); ++i) {
+        PopulateVertex(edge_tracker_, static_cast<int>(i - 1), sites_[i], &vt);
+        output_.AddLineVertex(vt);
+      }
+      output_.FinishLine();
+    }
+
+    out->SetDimensions(value0.dimensions());
+    output_.WriteTo(out, value0.geometry_type());
+    return true;
+  }
+
+  // Check that every input vertex snaps to its own site (i.e., sites are
+  // more than twice the snap radius apart) and that no site is within the
+  // maximum edge deviation of an input or snapped edge that it is not an
+  // endpoint of.
+  bool SitesAreSeparated(const S2Shape& lines) const {
+    S1Angle snap_radius = builder_options_.snap_function().snap_radius();
+    S1ChordAngle min_separation(2 * snap_radius);
+    for (size_t i = 0; i < sites_.size(); ++i) {
+      for (size_t j = i + 1; j < sites_.size(); ++j) {
+        if (S1ChordAngle(sites_[i], sites_[j]) <= min_separation) {
+          return false;
+        }
+      }
+    }
+
+    S1ChordAngle limit =
+        S1ChordAngle(builder_options_.max_edge_deviation()).Successor();
+    for (size_t e = 0; e + 1 < sites_.size(); ++e) {
+      S2Shape::Edge edge = lines.edge(static_cast<int>(e));
+      for (size_t k = 0; k < sites_.size(); ++k) {
+        if (k == e || k == e + 1) {
+          continue;
+        }
+
+        if (S2::IsDistanceLess(sites_[k], edge.v0, edge.v1, limit) ||
+            S2::IsDistanceLess(sites_[k], sites_[e], sites_[e + 1], limit)) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // Checking separation is quadratic in the number of vertices, so longer
+  // linestrings always use the builder
+  static constexpr int kMaxSimpleEdges = 32;
+
   S2Builder builder_;
   S2Builder::Options builder_options_;
   EdgeTracker edge_tracker_;
   OutputGeometry output_;
+  GeoArrowPolygonLayer polygon_layer_{&output_, &edge_tracker_};
+  std::vector<S2Point> sites_;
 };
 
 struct ReducePrecisionExec {
@@ -1168,30 +1880,45 @@ struct ReducePrecisionExec {
   using out_t = GeoArrowOutputBuilder;
 
   void Exec(arg0_t::c_type value, double grid_size, out_t* out) {
-    // If the grid size changed since the last iteration, we need to recreate
-    // the snap function and reinitialize the builder with the new options
-    if (grid_size != last_grid_size_) {
-      if (grid_size > 0) {
-        int exponent = static_cast<int>(std::round(-std::log10(grid_size)));
-        exponent = std::max(
-            s2builderutil::IntLatLngSnapFunction::kMinExponent,
-            std::min(s2builderutil::IntLatLngSnapFunction::kMaxExponent,
-                     exponent));
-        s2builderutil::IntLatLngSnapFunction snap(exponent);
-        rebuild_.builder_options_.set_snap_function(snap);
-      } else {
-        s2builderutil::IdentitySnapFunction snap;
-        rebuild_.builder_options_.set_snap_function(snap);
+    // A NaN grid size has no result (and would never match a cached builder)
+    if (std::isnan(grid_size)) {
+      out->AppendNull();
+      return;
+    }
+
+    // If the grid size changed since the last iteration, we need a builder
+    // initialized with the snap function for the new grid size
+    if (rebuild_ == nullptr || grid_size != last_grid_size_) {
+      rebuild_ = rebuilds_.Find(grid_size);
+      if (rebuild_ == nullptr) {
+        rebuild_ = rebuilds_.Insert(grid_size, MakeRebuild(grid_size));
       }
 
-      rebuild_.builder_.Init(rebuild_.builder_options_);
       last_grid_size_ = grid_size;
     }
 
-    rebuild_.Exec(value, out);
+    rebuild_->Exec(value, out);
+  }
+
+  static std::unique_ptr<RebuildExec> MakeRebuild(double grid_size) {
+    S2Builder::Options options;
+    if (grid_size > 0) {
+      int exponent = static_cast<int>(std::round(-std::log10(grid_size)));
+      exponent =
+          std::max(s2builderutil::IntLatLngSnapFunction::kMinExponent,
+                   std::min(s2builderutil::IntLatLngSnapFunction::kMaxExponent,
+                            exponent));
+      options.set_snap_function(
+          s2builderutil::IntLatLngSnapFunction(exponent));
+    } else {
+      options.set_snap_function(s2builderutil::IdentitySnapFunction());
+    }
+
+    return absl::make_unique<RebuildExec>(options);
   }
 
-  RebuildExec rebuild_;
+  ParamCache<double, RebuildExec> rebuilds_;
+  RebuildExec* rebuild_{nullptr};
   double last_grid_size_{-100};
 };
 
@@ -1201,47 +1928,61 @@ struct SimplifyExec {
   using out_t = GeoArrowOutputBuilder;
 
   void Exec(arg0_t::c_type value, double tolerance, out_t* out) {
-    // If the grid size changed since the last iteration, we need to recreate
-    // the snap function and reinitialize the builder with the new options
+    // A NaN tolerance has no result (and would never match a cached builder)
+    if (std::isnan(tolerance)) {
+      out->AppendNull();
+      return;
+    }
+
     if (tolerance < 0) {
       // PostGIS seems to do this
       tolerance = -tolerance;
     }
 
-    if (tolerance != last_tolerance_) {
-      // Create the identity snap function
-      S1Angle tolerance_angle =
-          S1Angle::Radians(tolerance / S2Earth::RadiusMeters());
-      s2builderutil::IdentitySnapFunction snap(tolerance_angle);
-      rebuild_.builder_options_.set_snap_function(snap);
-
-      rebuild_.builder_options_.set_simplify_edge_chains(true);
+    // If the tolerance changed since the last iteration, we need a builder
+    // initialized with the snap function for the new tolerance
+    if (rebuild_ == nullptr || tolerance != last_tolerance_) {
+      rebuild_ = rebuilds_.Find(tolerance);
+      if (rebuild_ == nullptr) {
+        rebuild_ = rebuilds_.Insert(tolerance, MakeRebuild(tolerance));
+      }
 
-      rebuild_.builder_.Init(rebuild_.builder_options_);
       last_tolerance_ = tolerance;
     }
 
-    rebuild_.Exec(value, out);
+    rebuild_->Exec(value, out);
+  }
+
+  static std::unique_ptr<RebuildExec> MakeRebuild(double tolerance) {
+    S1Angle tolerance_angle =
+        S1Angle::Radians(tolerance / S2Earth::RadiusMeters());
+    S2Builder::Options options(
+        s2builderutil::IdentitySnapFunction(tolerance_angle));
+    options.set_simplify_edge_chains(true);
+    return absl::make_unique<RebuildExec>(options);
   }
 
-  RebuildExec rebuild_;
+  ParamCache<double, RebuildExec> rebuilds_;
+  RebuildExec* rebuild_{nullptr};
   double last_tolerance_{-100};
 };
 
 namespace {
 
 /// \brief Run an S2BooleanOperation with the standard 3-layer closed-set
-/// output (points, polylines, polygons).
+/// output (points, polylines, polygons). The polygon layer is kept by the
+/// caller (and writes to the same output) such that its scratch space is
+/// reused from row to row.
 void BuildOverlay(S2BooleanOperation::OpType op_type,
                   const S2ShapeIndex& index0, const S2ShapeIndex& index1,
                   const S2BooleanOperation::Options& options,
-                  OutputGeometry* output) {
+                  OutputGeometry* output, GeoArrowPolygonLayer* polygon_layer) {
   // Note: we can't share op between iterations of the loop if we use
   // the closed set normalizer, which is not designed for this.
   s2builderutil::LayerVector layers(3);
   layers[0] = absl::make_unique<GeoArrowPointVectorLayer>(output);
   layers[1] = absl::make_unique<GeoArrowPolylinesLayer>(output);
-  layers[2] = absl::make_unique<GeoArrowPolygonLayer>(output);
+  layers[2] = absl::make_unique<LayerRef>(polygon_layer);
 
   S2BooleanOperation op(
       op_type, s2builderutil::NormalizeClosedSet(std::move(layers)), options);
@@ -1254,6 +1995,76 @@ void BuildOverlay(S2BooleanOperation::OpType op_type,
   }
 }
 
+/// \brief Classify a geography against the polygons of an indexed geography
+///
+/// Overlays between a prepared (i.e., indexed) polygon scalar and many small
+/// geographies (e.g., clipping parcels to administrative boundaries) usually
+/// involve rows that are entirely inside or entirely outside the polygon.
+/// These can be detected using the polygon's index without running an
+/// S2BooleanOperation: no edge of the row may touch or cross the polygon's
+/// boundary, all vertices of the row must be on the same side, and (for
+/// polygon rows) the row may not enclose any part of the polygon's boundary.
+/// Anything else (including non-polygon or unindexed containers) is
+/// kUnknown such that the caller falls back to the full overlay.
+class PreparedPolygonClassifier {
+ public:
+  enum class Position { kInside, kOutside, kUnknown };
+
+  Position Classify(const GeoArrowGeography& polygon,
+                    const GeoArrowGeography& geog) {
+    int dimension = geog.dimension();
+    if (polygon.is_unindexed() || polygon.dimension() != 2 || dimension < 0) {
+      return Position::kUnknown;
+    }
+
+    const S2ShapeIndex& index = polygon.ShapeIndex();
+    S2CrossingEdgeQuery crossing_query(&index);
+    if (!geog.VisitNonPointEdges([&](const S2Shape::Edge& e) {
+          crossing_query.GetCrossingEdges(e.v0, e.v1,
+                                          s2shapeutil::CrossingType::ALL,
+                                          &crossing_edges_);
+          return crossing_edges_.empty();
+        })) {
+      return Position::kUnknown;
+    }
+
+    auto contains_query = MakeS2ContainsPointQuery(
+        &index, S2ContainsPointQueryOptions(S2VertexModel::CLOSED));
+    int64_t num_inside = 0;
+    int64_t num_outside = 0;
+    geog.VisitVertices([&](const S2Point& pt) {
+      if (contains_query.Contains(pt)) {
+        ++num_inside;
+      } else {
+        ++num_outside;
+      }
+
+      return num_inside == 0 || num_outside == 0;
+    });
+
+    if (num_inside > 0 && num_outside > 0) {
+      return Position::kUnknown;
+    }
+
+    // A polygon row may enclose a loop of the container (e.g., one of its
+    // holes) without crossing it
+    if (dimension == 2) {
+      const GeoArrowLaxPolygonShape* loops = polygon.polygons();
+      for (int i = 0; i < loops->num_chains(); i++) {
+        if (loops->chain(i).length > 0 &&
+            geog.polygons()->BruteForceContains(loops->chain_edge(i, 0).v0)) {
+          return Position::kUnknown;
+        }
+      }
+    }
+
+    return num_inside > 0 ? Position::kInside : Position::kOutside;
+  }
+
+ private:
+  std::vector<s2shapeutil::ShapeEdge> crossing_edges_;
+};
+
 }  // namespace
 
 struct UnionOperationExec {
@@ -1300,7 +2111,7 @@ struct UnionOperationExec {
     }
 
     BuildOverlay(S2BooleanOperation::OpType::UNION, value0.ShapeIndex(),
-                 value1.ShapeIndex(), options_, &output_);
+                 value1.ShapeIndex(), options_, &output_, &polygon_layer_);
 
     output_.WriteTo(out);
   }
@@ -1324,6 +2135,7 @@ struct UnionOperationExec {
   S2BooleanOperation::Options options_;
   std::vector<S2CellId> intersection_;
   OutputGeometry output_;
+  GeoArrowPolygonLayer polygon_layer_{&output_};
 };
 
 struct IntersectionOperationExec {
@@ -1358,8 +2170,25 @@ struct IntersectionOperationExec {
       return;
     }
 
+    // If the larger side is an indexed (e.g., prepared scalar) polygon, the
+    // other side may be entirely inside or outside of it and not need an
+    // overlay
+    bool value1_is_container = value1.num_edges() >= value0.num_edges();
+    const GeoArrowGeography& container = value1_is_container ? value1 : value0;
+    const GeoArrowGeography& other = value1_is_container ? value0 : value1;
+    switch (classifier_.Classify(container, other)) {
+      case PreparedPolygonClassifier::Position::kInside:
+        out->AppendGeometry(other.geom());
+        return;
+      case PreparedPolygonClassifier::Position::kOutside:
+        out->AppendEmpty(OutputEmptyGeometryType(value0, value1));
+        return;
+      default:
+        break;
+    }
+
     BuildOverlay(S2BooleanOperation::OpType::INTERSECTION, value0.ShapeIndex(),
-                 value1.ShapeIndex(), options_, &output_);
+                 value1.ShapeIndex(), options_, &output_, &polygon_layer_);
     output_.WriteTo(out, OutputEmptyGeometryType(value0, value1));
   }
 
@@ -1381,7 +2210,9 @@ struct IntersectionOperationExec {
 
   S2BooleanOperation::Options options_;
   std::vector<S2CellId> intersection_;
+  PreparedPolygonClassifier classifier_;
   OutputGeometry output_;
+  GeoArrowPolygonLayer polygon_layer_{&output_};
 };
 
 struct DifferenceOperationExec {
@@ -1422,8 +2253,28 @@ struct DifferenceOperationExec {
       return;
     }
 
+    // If the larger side is an indexed (e.g., prepared scalar) polygon, the
+    // other side may be entirely inside or outside of it and not need an
+    // overlay
+    if (value1.num_edges() >= value0.num_edges()) {
+      switch (classifier_.Classify(value1, value0)) {
+        case PreparedPolygonClassifier::Position::kInside:
+          out->AppendEmpty(OutputEmptyGeometryType(value0));
+          return;
+        case PreparedPolygonClassifier::Position::kOutside:
+          out->AppendGeometry(value0.geom());
+          return;
+        default:
+          break;
+      }
+    } else if (classifier_.Classify(value0, value1) ==
+               PreparedPolygonClassifier::Position::kOutside) {
+      out->AppendGeometry(value0.geom());
+      return;
+    }
+
     BuildOverlay(S2BooleanOperation::OpType::DIFFERENCE, value0.ShapeIndex(),
-                 value1.ShapeIndex(), options_, &output_);
+                 value1.ShapeIndex(), options_, &output_, &polygon_layer_);
     output_.WriteTo(out, OutputEmptyGeometryType(value0));
   }
 
@@ -1442,7 +2293,9 @@ struct DifferenceOperationExec {
 
   S2BooleanOperation::Options options_;
   std::vector<S2CellId> intersection_;
+  PreparedPolygonClassifier classifier_;
   OutputGeometry output_;
+  GeoArrowPolygonLayer polygon_layer_{&output_};
 };
 
 struct SymDifferenceOperationExec {
@@ -1490,7 +2343,8 @@ struct SymDifferenceOperationExec {
     }
 
     BuildOverlay(S2BooleanOperation::OpType::SYMMETRIC_DIFFERENCE,
-                 value0.ShapeIndex(), value1.ShapeIndex(), options_, &output_);
+                 value0.ShapeIndex(), value1.ShapeIndex(), options_, &output_,
+                 &polygon_layer_);
     output_.WriteTo(out, OutputEmptyGeometryType(value0, value1));
   }
 
@@ -1513,6 +2367,7 @@ struct SymDifferenceOperationExec {
   S2BooleanOperation::Options options_;
   std::vector<S2CellId> intersection_;
   OutputGeometry output_;
+  GeoArrowPolygonLayer polygon_layer_{&output_};
 };
 
 namespace {
@@ -1615,6 +2470,12 @@ struct BufferParamsExec {
 
   void Exec(arg0_t::c_type value, arg1_t::c_type distance,
             arg2_t::c_type params, out_t* out) {
+    // A NaN distance has no result (and would never match cached options)
+    if (std::isnan(distance)) {
+      out->AppendNull();
+      return;
+    }
+
     // For what will definitely be empty or degenerate output, we return POLYGON
     // EMPTY
     if (value.is_empty() || (value.max_dimension() < 2 && distance <= 0)) {
@@ -1622,47 +2483,29 @@ struct BufferParamsExec {
       return;
     }
 
-    if (distance != last_distance_ || last_params_ != params) {
-      BufferParams parsed = BufferParams::Parse(params);
-
-      S2BufferOperation::Options options;
-      auto buffer_angle = S1Angle::Radians(distance / S2Earth::RadiusMeters());
-      options.set_buffer_radius(buffer_angle);
-
-      if (parsed.quadrant_segments < 0) {
-        throw Exception("quadrant_segments must be >0 in ST_Buffer()");
-      }
-      options.set_circle_segments(parsed.quadrant_segments * 4.0);
-
-      switch (parsed.end_cap_style) {
-        case CapStyle::kRound:
-          options.set_end_cap_style(S2BufferOperation::EndCapStyle::ROUND);
-          break;
-        case CapStyle::kFlat:
-          options.set_end_cap_style(S2BufferOperation::EndCapStyle::FLAT);
-          break;
-      }
-
-      switch (parsed.side) {
-        case BufferSide::kLeft:
-          options.set_polyline_side(S2BufferOperation::PolylineSide::LEFT);
-          break;
-        case BufferSide::kRight:
-          options.set_polyline_side(S2BufferOperation::PolylineSide::RIGHT);
-          break;
-        case BufferSide::kBoth:
-          options.set_polyline_side(S2BufferOperation::PolylineSide::BOTH);
-          break;
+    // Options (and the buffer of a single point computed from them) are
+    // cached for recently used parameter values such that alternating
+    // values (e.g., a per-row distance) don't rebuild them for every row
+    if (state_ == nullptr || distance != last_distance_ ||
+        last_params_ != params) {
+      std::pair<double, std::string> key(distance, std::string(params));
+      state_ = states_.Find(key);
+      if (state_ == nullptr) {
+        state_ = states_.Insert(key, MakeState(distance, params));
       }
 
-      options_ = options;
       last_distance_ = distance;
-      last_params_ = params;
+      last_params_ = std::move(key.second);
     }
 
     output_.Clear();
+    if (value.dimension() == 0 && AddPointBuffers(value)) {
+      output_.WriteTo(out, GEOARROW_GEOMETRY_TYPE_POLYGON);
+      return;
+    }
+
     S2BufferOperation op;
-    op.Init(std::make_unique<GeoArrowPolygonLayer>(&output_), options_);
+    op.Init(absl::make_unique<LayerRef>(&polygon_layer_), state_->options);
 
     // AddShape doesn't handle dimension-0 shapes (points); use AddPoint for
     // each point vertex instead.
@@ -1683,10 +2526,165 @@ struct BufferParamsExec {
     output_.WriteTo(out, GEOARROW_GEOMETRY_TYPE_POLYGON);
   }
 
+  // Options derived from one distance and params string plus the buffer of
+  // a single point computed lazily from them
+  struct BufferState {
+    S2BufferOperation::Options options;
+    bool point_buffer_valid{false};
+    OutputGeometry point_buffer_output;
+    std::vector<S2Point> point_buffer;
+    S1ChordAngle point_buffer_radius;
+  };
+
+  static std::unique_ptr<BufferState> MakeState(double distance,
+                                                std::string_view params) {
+    BufferParams parsed = BufferParams::Parse(params);
+
+    S2BufferOperation::Options options;
+    auto buffer_angle = S1Angle::Radians(distance / S2Earth::RadiusMeters());
+    options.set_buffer_radius(buffer_angle);
+
+    if (parsed.quadrant_segments < 0) {
+      throw Exception("quadrant_segments must be >0 in ST_Buffer()");
+    }
+    options.set_circle_segments(parsed.quadrant_segments * 4.0);
+
+    switch (parsed.end_cap_style) {
+      case CapStyle::kRound:
+        options.set_end_cap_style(S2BufferOperation::EndCapStyle::ROUND);
+        break;
+      case CapStyle::kFlat:
+        options.set_end_cap_style(S2BufferOperation::EndCapStyle::FLAT);
+        break;
+    }
+
+    switch (parsed.side) {
+      case BufferSide::kLeft:
+        options.set_polyline_side(S2BufferOperation::PolylineSide::LEFT);
+        break;
+      case BufferSide::kRight:
+        options.set_polyline_side(S2BufferOperation::PolylineSide::RIGHT);
+        break;
+      case BufferSide::kBoth:
+        options.set_polyline_side(S2BufferOperation::PolylineSide::BOTH);
+        break;
+    }
+
+    auto state = absl::make_unique<BufferState>();
+    state->options = options;
+    return state;
+  }
+
+  // Add the buffer of each point in value to output_ by rotating the buffer
+  // of a single point computed once per set of options. Returns false if
+  // the buffers of any two points might overlap (in which case they must be
+  // unioned by the S2BufferOperation) or the buffer of a point isn't a
+  // single ring (e.g., for very large distances).
+  bool AddPointBuffers(const GeoArrowGeography& value) {
+    if (!state_->point_buffer_valid) {
+      InitPointBuffer(state_);
+    }
+
+    const std::vector<S2Point>& point_buffer = state_->point_buffer;
+    if (point_buffer.empty()) {
+      return false;
+    }
+
+    centers_.clear();
+    value.points()->geom().VisitVertices([&](const S2Point& v) {
+      centers_.push_back(v);
+      return true;
+    });
+
+    if (centers_.size() > kMaxPointBuffers) {
+      return false;
+    }
+
+    S1ChordAngle min_separation =
+        state_->point_buffer_radius + state_->point_buffer_radius;
+    for (size_t i = 0; i < centers_.size(); i++) {
+      for (size_t j = i + 1; j < centers_.size(); j++) {
+        if (S1ChordAngle(centers_[i], centers_[j]) <= min_separation) {
+          return false;
+        }
+      }
+    }
+
+    internal::GeoArrowVertex vt;
+    for (const S2Point& center : centers_) {
+      if (center == kPointBufferCenter) {
+        // Avoid any rounding error for the center of the cached buffer
+        state_->point_buffer_output.VisitRingVertices(
+            0, [&](const internal::GeoArrowVertex& v) {
+              output_.AddRingVertex(v);
+            });
+      } else if (center.x() >= 0) {
+        for (const S2Point& v : point_buffer) {
+          vt.SetPoint(Rotate(kPointBufferCenter, center, v));
+          output_.AddRingVertex(vt);
+        }
+      } else {
+        // Rotating between nearly antipodal points is unstable, so start
+        // from the buffer of the antipode of kPointBufferCenter instead
+        for (const S2Point& v : point_buffer) {
+          S2Point flipped(-v.x(), -v.y(), v.z());
+          vt.SetPoint(Rotate(-kPointBufferCenter, center, flipped));
+          output_.AddRingVertex(vt);
+        }
+      }
+
+      output_.FinishRing();
+    }
+
+    return true;
+  }
+
+  // Rotate v by the rotation about a x b that takes unit vector a to unit
+  // vector b (Rodrigues' formula with the axis scaled by sin(theta)). This
+  // is accurate when a and b are not nearly antipodal.
+  static S2Point Rotate(const S2Point& a, const S2Point& b, const S2Point& v) {
+    S2Point w = a.CrossProd(b);
+    double cos_theta = a.DotProd(b);
+    return v * cos_theta + w.CrossProd(v) +
+           w * (w.DotProd(v) / (1 + cos_theta));
+  }
+
+  static void InitPointBuffer(BufferState* state) {
+    state->point_buffer_valid = true;
+    state->point_buffer.clear();
+    state->point_buffer_radius = S1ChordAngle::Zero();
+    state->point_buffer_output.Clear();
+
+    S2BufferOperation op;
+    op.Init(std::make_unique<GeoArrowPolygonLayer>(&state->point_buffer_output),
+            state->options);
+    op.AddPoint(kPointBufferCenter);
+    S2Error error;
+    if (!op.Build(&error) || state->point_buffer_output.num_rings() != 1) {
+      return;
+    }
+
+    state->point_buffer_output.VisitRingVertices(
+        0, [&](const internal::GeoArrowVertex& v) {
+          state->point_buffer.push_back(v.ToPoint());
+          state->point_buffer_radius = std::max(
+              state->point_buffer_radius,
+              S1ChordAngle(kPointBufferCenter, state->point_buffer.back()));
+        });
+  }
+
+  // Above this number of points, checking every pair of buffers for overlap
+  // is likely more expensive than the S2BufferOperation
+  static constexpr size_t kMaxPointBuffers = 64;
+  static inline const S2Point kPointBufferCenter{1, 0, 0};
+
+  ParamCache<std::pair<double, std::string>, BufferState> states_;
+  BufferState* state_{nullptr};
   double last_distance_{-std::numeric_limits<double>::infinity()};
   std::string last_params_;
-  S2BufferOperation::Options options_;
   OutputGeometry output_;
+  GeoArrowPolygonLayer polygon_layer_{&output_};
+  std::vector<S2Point> centers_;
 };
 
 struct BufferQuadSegsExec {
@@ -1717,6 +2715,119 @@ struct BufferExec {
   BufferParamsExec buffer_params_;
 };
 
+/// \brief Split a geography into pieces bounded by S2 cells
+///
+/// Starting with the cells of the geography's covering, each piece is
+/// clipped to a cell and split into the cell's children until it has at
+/// most max_vertices vertices. Each piece is clipped from its parent piece
+/// rather than the original input such that the cost of clipping shrinks
+/// with the size of the piece. Cells are clipped with the semi-open polygon
+/// model such that a point or polyline edge on the boundary shared by two
+/// cells is assigned to exactly one of their pieces.
+///
+/// Input with at most max_vertices vertices is emitted as a single piece with
+/// its Z and M values; pieces of larger input are computed by the
+/// S2BooleanOperation and are always XY.
+struct SubdivideExec {
+  using arg0_t = GeoArrowGeographyInputView;
+  using arg1_t = IntInputView;
+  using out_t = ListOutputBuilder<GeoArrowOutputBuilder>;
+
+  SubdivideExec() {
+    options_.boolean_operation.set_polygon_model(
+        S2BooleanOperation::PolygonModel::SEMI_OPEN);
+  }
+
+  void Exec(arg0_t::c_type value, int64_t max_vertices, out_t* out) {
+    if (max_vertices < kMinVertices) {
+      throw Exception("st_subdivide() requires max_vertices >= " +
+                      std::to_string(kMinVertices));
+    }
+
+    max_vertices_ = max_vertices;
+    GeoArrowOutputBuilder& items = out->items();
+    if (value.is_empty()) {
+      out->Append();
+      return;
+    }
+
+    // Small input is emitted as is (which also preserves its ZM values)
+    if (NumVertices(value) <= max_vertices_) {
+      output_.Clear();
+      output_.AddGeography(value);
+      items.SetDimensions(value.dimensions());
+      output_.WriteTo(&items, value.geometry_type());
+      out->Append();
+      return;
+    }
+
+    items.SetDimensions(GEOARROW_DIMENSIONS_XY);
+    for (S2CellId cell_id : value.Covering()) {
+      SubdivideCell(value.ShapeIndex(), cell_id, &items);
+    }
+
+    out->Append();
+  }
+
+  void SubdivideCell(const S2ShapeIndex& index, S2CellId cell_id,
+                     GeoArrowOutputBuilder* items) {
+    S2Polygon cell_polygon{S2Cell(cell_id)};
+    MutableS2ShapeIndex cell_index;
+    cell_index.Add(absl::make_unique<S2Polygon::Shape>(&cell_polygon));
+    std::unique_ptr<Geography> piece = s2_boolean_operation(
+        index, cell_index, S2BooleanOperation::OpType::INTERSECTION, options_);
+
+    int64_t num_vertices = NumVertices(*piece);
+    if (num_vertices == 0) {
+      return;
+    }
+
+    if (num_vertices <= max_vertices_ || cell_id.is_leaf()) {
+      output_.Clear();
+      for (int i = 0; i < piece->num_shapes(); ++i) {
+        output_.AddShape(*piece->Shape(i));
+      }
+      output_.WriteTo(items);
+      return;
+    }
+
+    ShapeIndexGeography piece_index(*piece);
+    for (S2CellId child = cell_id.child_begin(); child != cell_id.child_end();
+         child = child.next()) {
+      SubdivideCell(piece_index.ShapeIndex(), child, items);
+    }
+  }
+
+  static int64_t NumVertices(const S2Shape& shape) {
+    int64_t num_vertices = shape.num_edges();
+    if (shape.dimension() == 1) {
+      num_vertices += shape.num_chains();
+    }
+
+    return num_vertices;
+  }
+
+  static int64_t NumVertices(const GeoArrowGeography& geog) {
+    return NumVertices(*geog.points()) + NumVertices(*geog.lines()) +
+           NumVertices(*geog.polygons());
+  }
+
+  static int64_t NumVertices(const Geography& geog) {
+    int64_t num_vertices = 0;
+    for (int i = 0; i < geog.num_shapes(); ++i) {
+      num_vertices += NumVertices(*geog.Shape(i));
+    }
+
+    return num_vertices;
+  }
+
+  static constexpr int64_t kMinVertices = 8;
+
+  GlobalOptions options_;
+  OutputGeometry output_;
+  int64_t max_vertices_{};
+};
+
 void DifferenceKernel(struct SedonaCScalarKernel* out) {
   InitBinaryKernel<DifferenceOperationExec>(out, "st_difference");
 }
@@ -1753,6 +2864,10 @@ void BufferParamsKernel(struct SedonaCScalarKernel* out) {
   InitTernaryKernel<BufferParamsExec>(out, "st_buffer");
 }
 
+void SubdivideKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<SubdivideExec>(out, "st_subdivide");
+}
+
 }  // namespace sedona_udf
 
 }  // namespace s2geography
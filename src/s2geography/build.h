@@ -1,11 +1,15 @@
 
 #pragma once
 
+#include <s2/s2buffer_operation.h>
 #include <s2/s2builderutil_s2point_vector_layer.h>
 #include <s2/s2builderutil_s2polygon_layer.h>
 #include <s2/s2builderutil_s2polyline_vector_layer.h>
+#include <s2/s2cell_id.h>
 
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "s2geography/aggregator.h"
 #include "s2geography/geography.h"
@@ -49,6 +53,25 @@ std::unique_ptr<Geography> s2_boolean_operation(
                               options);
 }
 
+/// \brief Compute a boolean operation of two polygon indexes in parallel
+///
+/// Partitions the space covered by the output into at most about max_cells
+/// (non-overlapping) S2 cells, clips both inputs to each cell, and computes
+/// the operation for each cell using up to num_threads threads (or one
+/// thread per hardware thread if num_threads is zero). Inputs are clipped
+/// down the cell hierarchy so that each cell is clipped from the inputs as
+/// already clipped to an ancestor cell rather than from the whole input. The
+/// pieces are stitched back together with a final S2Builder pass that
+/// removes the cell boundaries. Any snapping specified by options is applied
+/// within each cell independently. Inputs that contain points or lines are
+/// computed with s2_boolean_operation() instead. Both indexes are queried
+/// concurrently and must support concurrent reads (e.g., a
+/// MutableS2ShapeIndex).
+std::unique_ptr<Geography> s2_boolean_operation_partitioned(
+    const S2ShapeIndex& geog1, const S2ShapeIndex& geog2,
+    S2BooleanOperation::OpType op_type, const GlobalOptions& options,
+    int max_cells = 64, int num_threads = 0);
+
 std::unique_ptr<Geography> s2_unary_union(const ShapeIndexGeography& geog,
                                           const GlobalOptions& options);
 
@@ -77,12 +100,25 @@ class S2CoverageUnionAggregator
  public:
   S2CoverageUnionAggregator(const GlobalOptions& options) : options_(options) {}
 
+  /// \brief Dissolve groups of nearby inputs in parallel
+  ///
+  /// Inputs are grouped by the S2 cell at group_level containing the center
+  /// of their bounds. Finalize() dissolves each group independently using up
+  /// to num_threads threads (or one per hardware thread if num_threads is
+  /// zero) and unions the dissolved groups along their shared boundaries.
+  /// Inputs must outlive this aggregator.
+  S2CoverageUnionAggregator(const GlobalOptions& options, int group_level,
+                            int num_threads = 0);
+
   void Add(const Geography& geog);
   std::unique_ptr<Geography> Finalize();
 
  private:
   GlobalOptions options_;
   ShapeIndexGeography index_;
+  int group_level_{-1};
+  int num_threads_{0};
+  std::vector<std::pair<S2CellId, const Geography*>> grouped_;
 };
 
 class S2UnionAggregator : public Aggregator<std::unique_ptr<Geography>> {
@@ -105,6 +141,34 @@ class S2UnionAggregator : public Aggregator<std::unique_ptr<Geography>> {
   std::vector<std::unique_ptr<Node>> other_;
 };
 
+/// \brief Buffer and dissolve geographies without building each buffer
+///
+/// Computes the union of the buffers of all inputs (e.g., service areas or
+/// proximity zones) by adding every input shape to a single
+/// S2BufferOperation, which unions its input natively. The buffer of each
+/// input is never materialized. Partial aggregators (e.g., one per
+/// partition) can be combined with Merge(), which unions their finalized
+/// output with this one's when this aggregator is finalized.
+///
+/// Finalize() and Merge() consume the aggregator that is finalized or
+/// merged: calling Add(), Merge(), or Finalize() on it afterwards throws.
+class S2BufferAggregator : public Aggregator<std::unique_ptr<Geography>> {
+ public:
+  explicit S2BufferAggregator(const S2BufferOperation::Options& options);
+
+  void Add(const Geography& geog);
+  void Merge(S2BufferAggregator&& other);
+  std::unique_ptr<Geography> Finalize();
+
+ private:
+  void CheckNotFinalized() const;
+  std::unique_ptr<S2Polygon> Build();
+
+  std::unique_ptr<S2Polygon> polygon_;
+  std::unique_ptr<S2BufferOperation> op_;
+  std::vector<std::unique_ptr<S2Polygon>> partials_;
+};
+
 namespace sedona_udf {
 
 void DifferenceKernel(struct SedonaCScalarKernel* out);
@@ -117,6 +181,17 @@ void BufferKernel(struct SedonaCScalarKernel* out);
 void BufferQuadSegsKernel(struct SedonaCScalarKernel* out);
 void BufferParamsKernel(struct SedonaCScalarKernel* out);
 
+/// \brief Split a geography into a list of pieces bounded by S2 cells
+///
+/// Takes a geography and a maximum number of vertices per piece (at least
+/// 8). Input with at most that many vertices is returned as a single piece
+/// (including any Z and M values); otherwise, pieces are clipped to
+/// successively smaller cells until they are small enough and are written
+/// with longitude and latitude only, such that only some rows of a result
+/// may have Z or M values. Points and edges on the boundary between two
+/// cells are assigned to exactly one piece.
+void SubdivideKernel(struct SedonaCScalarKernel* out);
+
 // Exposed for testing
 enum class CapStyle { kRound, kFlat };
 enum class BufferSide { kLeft, kRight, kBoth };
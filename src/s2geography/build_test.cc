@@ -1,12 +1,24 @@
 #include "s2geography/build.h"
 
 #include <gtest/gtest.h>
-
+#include <s2/s2builderutil_snap_functions.h>
+#include <s2/s2earth.h>
+#include <s2/s2edge_crossings.h>
+
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "nanoarrow/nanoarrow.hpp"
+#include "s2geography/accessors.h"
+#include "s2geography/distance.h"
+#include "s2geography/predicates.h"
 #include "s2geography/s2geography_gtest_util.h"
 #include "s2geography/sedona_udf/sedona_udf_test_internal.h"
+#include "s2geography/wkb.h"
 
 namespace s2geography {
 
@@ -145,6 +157,83 @@ TEST(Build, UnaryUnionRoundtrip) {
   ASSERT_NO_FATAL_FAILURE(TestUnaryUnionRoundtrip("MULTIPOLYGON"));
 }
 
+// Check that two geographies are equal except for vertices where an edge
+// was clipped to a cell boundary, which may be off the original edge by up
+// to the merge radius (e.g., pieces that were stitched back together). Such
+// differences collapse when the symmetric difference is snapped by the same
+// amount.
+void ExpectEqualAfterSnapping(const Geography& actual,
+                              const Geography& expected) {
+  ShapeIndexGeography actual_index(actual);
+  ShapeIndexGeography expected_index(expected);
+  GlobalOptions options;
+  options.boolean_operation.set_snap_function(
+      s2builderutil::IdentitySnapFunction(S2::kIntersectionMergeRadius));
+  auto difference = s2_boolean_operation(
+      actual_index, expected_index,
+      S2BooleanOperation::OpType::SYMMETRIC_DIFFERENCE, options);
+  EXPECT_TRUE(s2_is_empty(*difference))
+      << "area " << s2_area(*difference) << ", length "
+      << s2_length(*difference) << ", points " << s2_num_points(*difference);
+}
+
+void TestPartitionedBooleanOperation(const std::string& wkt1,
+                                     const std::string& wkt2,
+                                     S2BooleanOperation::OpType op_type) {
+  WKTReader reader;
+  auto geog1 = reader.read_feature(wkt1);
+  auto geog2 = reader.read_feature(wkt2);
+  ShapeIndexGeography index1(*geog1);
+  ShapeIndexGeography index2(*geog2);
+
+  GlobalOptions options;
+  auto expected = s2_boolean_operation(index1, index2, op_type, options);
+  auto actual = s2_boolean_operation_partitioned(
+      index1.ShapeIndex(), index2.ShapeIndex(), op_type, options,
+      /*max_cells=*/16, /*num_threads=*/4);
+
+  EXPECT_EQ(s2_dimension(*actual), s2_dimension(*expected));
+  EXPECT_NEAR(s2_area(*actual), s2_area(*expected), 1e-9);
+  ASSERT_NO_FATAL_FAILURE(ExpectEqualAfterSnapping(*actual, *expected));
+}
+
+TEST(Build, PartitionedBooleanOperation) {
+  std::string poly1 = "POLYGON ((0 0, 40 0, 40 40, 0 40, 0 0))";
+  std::string poly2 = "POLYGON ((20 20, 60 20, 60 60, 20 60, 20 20))";
+  std::string poly3 = "POLYGON ((100 0, 110 0, 110 10, 100 10, 100 0))";
+  std::string poly4 =
+      "POLYGON ((-10 -10, 70 -10, 70 70, -10 70, -10 -10), "
+      "(0 0, 10 0, 10 50, 0 50, 0 0), (30 30, 50 30, 50 35, 30 35, 30 30))";
+
+  for (auto op_type : {S2BooleanOperation::OpType::INTERSECTION,
+                       S2BooleanOperation::OpType::UNION,
+                       S2BooleanOperation::OpType::DIFFERENCE,
+                       S2BooleanOperation::OpType::SYMMETRIC_DIFFERENCE}) {
+    SCOPED_TRACE(static_cast<int>(op_type));
+    ASSERT_NO_FATAL_FAILURE(
+        TestPartitionedBooleanOperation(poly1, poly2, op_type));
+    ASSERT_NO_FATAL_FAILURE(
+        TestPartitionedBooleanOperation(poly1, poly3, op_type));
+    ASSERT_NO_FATAL_FAILURE(
+        TestPartitionedBooleanOperation(poly4, poly2, op_type));
+  }
+
+  // Input that is not all polygons uses the unpartitioned operation
+  WKTReader reader;
+  auto geog1 = reader.read_feature(poly1);
+  auto geog2 = reader.read_feature("LINESTRING (-10 10, 50 10)");
+  ShapeIndexGeography index1(*geog1);
+  ShapeIndexGeography index2(*geog2);
+  auto expected = s2_boolean_operation(
+      index1, index2, S2BooleanOperation::OpType::INTERSECTION,
+      GlobalOptions());
+  auto actual = s2_boolean_operation_partitioned(
+      index1.ShapeIndex(), index2.ShapeIndex(),
+      S2BooleanOperation::OpType::INTERSECTION, GlobalOptions());
+  EXPECT_EQ(s2_dimension(*actual), 1);
+  EXPECT_EQ(s2_length(*actual), s2_length(*expected));
+}
+
 TEST(Build, SedonaUdfIntersection) {
   struct SedonaCScalarKernel kernel;
   s2geography::sedona_udf::IntersectionKernel(&kernel);
@@ -451,6 +540,123 @@ INSTANTIATE_TEST_SUITE_P(
       return info.param.name;
     });
 
+// Rows classified against a prepared polygon scalar with a hole. The last
+// two rows straddle or enclose part of its boundary and need the overlay.
+const char* kPreparedPolygon =
+    "POLYGON ((0 0, 20 0, 20 20, 0 20, 0 0), (8 8, 12 8, 12 12, 8 12, 8 8))";
+const std::vector<std::optional<std::string>> kPreparedPolygonRows{
+    "POLYGON ((1 1, 5 1, 5 5, 1 5, 1 1))",
+    "POLYGON ((21 1, 25 1, 25 5, 21 5, 21 1))",
+    "LINESTRING (2 2, 4 4)",
+    "POINT (5 5)",
+    "POINT (10 10)",
+    std::nullopt,
+    "POLYGON ((6 6, 14 6, 14 14, 6 14, 6 6))",
+    "LINESTRING (-5 5, 5 5)"};
+
+std::vector<std::optional<std::string>> ResultWkt(struct ArrowArray* result) {
+  nanoarrow::UniqueArrayView result_view;
+  ArrowArrayViewInitFromType(result_view.get(), NANOARROW_TYPE_BINARY);
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewSetArray(result_view.get(), result, nullptr));
+
+  std::vector<std::optional<std::string>> out;
+  for (int64_t i = 0; i < result->length; i++) {
+    if (ArrowArrayViewIsNull(result_view.get(), i)) {
+      out.push_back(std::nullopt);
+      continue;
+    }
+
+    auto bytes = ArrowArrayViewGetBytesUnsafe(result_view.get(), i);
+    std::vector<uint8_t> wkb(bytes.data.as_uint8,
+                             bytes.data.as_uint8 + bytes.size_bytes);
+    out.push_back(TestGeometry::FromWKB(wkb).ToWKT(6));
+  }
+
+  return out;
+}
+
+// Check that rows emitted without an overlay describe the same geography as
+// the overlay's (builder-normalized) output for the same row
+void ExpectSameAsOverlay(
+    const std::vector<std::optional<std::string>>& actual,
+    const std::vector<std::optional<std::string>>& overlay) {
+  ASSERT_EQ(actual.size(), overlay.size());
+  WKTReader reader;
+  for (size_t i = 0; i < actual.size(); i++) {
+    SCOPED_TRACE("row " + std::to_string(i));
+    ASSERT_EQ(actual[i].has_value(), overlay[i].has_value());
+    if (!actual[i].has_value()) {
+      continue;
+    }
+
+    auto actual_geog = reader.read_feature(*actual[i]);
+    auto overlay_geog = reader.read_feature(*overlay[i]);
+    ShapeIndexGeography actual_index(*actual_geog);
+    ShapeIndexGeography overlay_index(*overlay_geog);
+    EXPECT_TRUE(s2_equals(actual_index, overlay_index,
+                          S2BooleanOperation::Options()))
+        << *actual[i] << " vs. " << *overlay[i];
+  }
+}
+
+// Execute a binary overlay kernel for kPreparedPolygonRows against
+// kPreparedPolygon either as a (prepared) scalar or as an array
+void ExecutePreparedPolygonOverlay(
+    void (*init_kernel)(struct SedonaCScalarKernel*), bool scalar,
+    struct ArrowArray* out) {
+  struct SedonaCScalarKernel kernel;
+  init_kernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB}, ARROW_TYPE_WKB));
+
+  std::vector<std::optional<std::string>> polygons(
+      scalar ? 1 : kPreparedPolygonRows.size(), kPreparedPolygon);
+  ASSERT_NO_FATAL_FAILURE(
+      TestExecuteKernel(&impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+                        {kPreparedPolygonRows, polygons}, {}, out));
+  impl.release(&impl);
+  kernel.release(&kernel);
+}
+
+TEST(Build, SedonaUdfIntersectionPreparedPolygon) {
+  nanoarrow::UniqueArray overlay_array;
+  ASSERT_NO_FATAL_FAILURE(ExecutePreparedPolygonOverlay(
+      s2geography::sedona_udf::IntersectionKernel, false,
+      overlay_array.get()));
+  auto overlay = ResultWkt(overlay_array.get());
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(ExecutePreparedPolygonOverlay(
+      s2geography::sedona_udf::IntersectionKernel, true, out_array.get()));
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(
+      out_array.get(),
+      {"POLYGON ((1 1, 5 1, 5 5, 1 5, 1 1))", "POLYGON EMPTY",
+       "LINESTRING (2 2, 4 4)", "POINT (5 5)", "POINT EMPTY", std::nullopt,
+       overlay[6], overlay[7]}));
+  ASSERT_NO_FATAL_FAILURE(
+      ExpectSameAsOverlay(ResultWkt(out_array.get()), overlay));
+}
+
+TEST(Build, SedonaUdfDifferencePreparedPolygon) {
+  nanoarrow::UniqueArray overlay_array;
+  ASSERT_NO_FATAL_FAILURE(ExecutePreparedPolygonOverlay(
+      s2geography::sedona_udf::DifferenceKernel, false, overlay_array.get()));
+  auto overlay = ResultWkt(overlay_array.get());
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(ExecutePreparedPolygonOverlay(
+      s2geography::sedona_udf::DifferenceKernel, true, out_array.get()));
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(
+      out_array.get(),
+      {"POLYGON EMPTY", "POLYGON ((21 1, 25 1, 25 5, 21 5, 21 1))",
+       "LINESTRING EMPTY", "POINT EMPTY", "POINT (10 10)", std::nullopt,
+       overlay[6], overlay[7]}));
+  ASSERT_NO_FATAL_FAILURE(
+      ExpectSameAsOverlay(ResultWkt(out_array.get()), overlay));
+}
+
 TEST(Build, SedonaUdfDifference) {
   struct SedonaCScalarKernel kernel;
   s2geography::sedona_udf::DifferenceKernel(&kernel);
@@ -697,6 +903,30 @@ TEST(Build, SedonaUdfReducePrecision) {
       out_array.get(), {"POINT (0 0)", "POINT (0 0)", std::nullopt}));
 }
 
+TEST(Build, SedonaUdfReducePrecisionAlternatingGridSize) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::ReducePrecisionKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE}, ARROW_TYPE_WKB));
+
+  // Builders for each grid size are cached; ensure that switching back and
+  // forth between them uses the snap function of the current row and that a
+  // NaN grid size gives a null result
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE},
+      {{"POINT (0.001 0.001)", "POINT (0.001 0.001)", "POINT (0.001 0.001)",
+        "POINT (0.001 0.001)", "POINT (0.001 0.001)"}},
+      {{1.0, -1.0, NAN, 1.0, -1.0}}, out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(
+      out_array.get(), {"POINT (0 0)", "POINT (0.001 0.001)", std::nullopt,
+                        "POINT (0 0)", "POINT (0.001 0.001)"}));
+}
+
 struct UnaryScalarOpParam {
   std::string name;
   std::optional<std::string> input_wkt;
@@ -773,6 +1003,10 @@ INSTANTIATE_TEST_SUITE_P(
         UnaryScalarOpParam{"linestring_snap",
                            "LINESTRING (0.001 0.001, 10.001 10.001)", 1.0,
                            "LINESTRING (0 0, 10 10)"},
+        // Linestring: vertices snap independently
+        UnaryScalarOpParam{"linestring_snap_vertices",
+                           "LINESTRING (0.01 0.01, 10.01 0.01, 10.01 10.01)",
+                           1.0, "LINESTRING (0 0, 10 0, 10 10)"},
         // Linestring: midpoints snap together on a grid
         UnaryScalarOpParam{"linestring_midpoint_snap",
                            "LINESTRING (0 0, 4.9 4.9, 5.1 5.1, 10 10)", 1.0,
@@ -923,7 +1157,21 @@ INSTANTIATE_TEST_SUITE_P(
                            -1,
                            "MULTIPOLYGON (((0 0, 20 0, 20 20, 0 20, 0 0), "
                            "(5 5, 5 15, 15 15, 15 5, 5 5)), "
-                           "((30 30, 40 30, 40 40, 30 40, 30 30)))"}),
+                           "((30 30, 40 30, 40 40, 30 40, 30 30)))"},
+        // Polygon with M (checks dimension mapping of ring output)
+        UnaryScalarOpParam{"polygon_m",
+                           "POLYGON M ((0 0 1, 10 0 2, 10 10 3, 0 10 4, "
+                           "0 0 1))",
+                           -1,
+                           "POLYGON M ((0 0 1, 10 0 2, 10 10 3, 0 10 4, "
+                           "0 0 1))"},
+        // Mixed output is written as a collection
+        UnaryScalarOpParam{"collection",
+                           "GEOMETRYCOLLECTION (POINT (30 30), "
+                           "LINESTRING (0 0, 10 10))",
+                           -1,
+                           "GEOMETRYCOLLECTION (POINT (30 30), "
+                           "LINESTRING (0 0, 10 10))"}),
     [](const ::testing::TestParamInfo<UnaryScalarOpParam>& info) {
       return info.param.name;
     });
@@ -938,14 +1186,14 @@ TEST(Build, SedonaUdfSimplify) {
   nanoarrow::UniqueArray out_array;
   ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
       &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE},
-      {{"POINT (0 0)", "LINESTRING (0 0, 10 0)", std::nullopt}},
-      {{0.0, 0.0, std::nullopt}}, out_array.get()));
+      {{"POINT (0 0)", "LINESTRING (0 0, 10 0)", "POINT (0 0)", std::nullopt}},
+      {{0.0, 0.0, NAN, std::nullopt}}, out_array.get()));
   impl.release(&impl);
   kernel.release(&kernel);
 
   ASSERT_NO_FATAL_FAILURE(TestResultGeography(
       out_array.get(),
-      {"POINT (0 0)", "LINESTRING (0 0, 10 0)", std::nullopt}));
+      {"POINT (0 0)", "LINESTRING (0 0, 10 0)", std::nullopt, std::nullopt}));
 }
 
 class SimplifyTest : public ::testing::TestWithParam<UnaryScalarOpParam> {};
@@ -1202,6 +1450,329 @@ INSTANTIATE_TEST_SUITE_P(
       return info.param.name;
     });
 
+TEST(Build, SedonaUdfBufferPoints) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::BufferKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE}, ARROW_TYPE_WKB));
+
+  // The first point is the center of the cached buffer; the next two are
+  // rotations of it (including one in the opposite hemisphere), the
+  // multipoint has disjoint buffers, and the last multipoint has overlapping
+  // buffers that must be unioned
+  std::vector<std::optional<std::string>> points{
+      "POINT (0 0)", "POINT (100 45)", "POINT (-170 -10)",
+      "MULTIPOINT ((0 0), (10 0))", "MULTIPOINT ((0 0), (0.5 0))"};
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(
+      TestExecuteKernel(&impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE},
+                        {points}, {{100000.0}}, out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  auto result = ResultWkt(out_array.get());
+  ASSERT_EQ(result.size(), points.size());
+
+  WKTReader reader;
+  std::vector<std::unique_ptr<Geography>> buffers;
+  for (const auto& wkt : result) {
+    ASSERT_TRUE(wkt.has_value());
+    buffers.push_back(reader.read_feature(*wkt));
+  }
+
+  auto center = reader.read_feature("POINT (0 0)");
+  double area = s2_area(*buffers[0]);
+  double radius = s2_max_distance(ShapeIndexGeography(*buffers[0]),
+                                  ShapeIndexGeography(*center));
+  for (size_t i = 1; i < 3; i++) {
+    SCOPED_TRACE(*points[i]);
+    auto point = reader.read_feature(*points[i]);
+    EXPECT_EQ(s2_num_points(*buffers[i]), s2_num_points(*buffers[0]));
+    EXPECT_NEAR(s2_area(*buffers[i]), area, area * 1e-4);
+    EXPECT_NEAR(s2_max_distance(ShapeIndexGeography(*buffers[i]),
+                                ShapeIndexGeography(*point)),
+                radius, radius * 1e-4);
+  }
+
+  EXPECT_EQ(result[3]->rfind("MULTIPOLYGON", 0), 0);
+  EXPECT_NEAR(s2_area(*buffers[3]), 2 * area, area * 1e-4);
+  EXPECT_EQ(result[4]->rfind("POLYGON", 0), 0);
+  EXPECT_LT(s2_area(*buffers[4]), 2 * area);
+}
+
+int NumLoops(const Geography& geog) {
+  return dynamic_cast<const PolygonGeography&>(geog).Polygon()->num_loops();
+}
+
+S2BufferOperation::Options TestBufferOptions(double distance_meters) {
+  S2BufferOperation::Options options;
+  options.set_buffer_radius(
+      S1Angle::Radians(distance_meters / S2Earth::RadiusMeters()));
+  return options;
+}
+
+TEST(Build, BufferAggregator) {
+  WKTReader reader;
+  auto point0 = reader.read_feature("POINT (0 0)");
+  auto point1 = reader.read_feature("POINT (10 0)");
+  auto point2 = reader.read_feature("POINT (0.5 0)");
+  auto line = reader.read_feature("LINESTRING (20 0, 21 0)");
+
+  S2BufferAggregator single(TestBufferOptions(100000));
+  single.Add(*point0);
+  double area = s2_area(*single.Finalize());
+  ASSERT_GT(area, 0);
+
+  // Disjoint buffers are not unioned with each other
+  S2BufferAggregator disjoint(TestBufferOptions(100000));
+  disjoint.Add(*point0);
+  disjoint.Add(*point1);
+  EXPECT_NEAR(s2_area(*disjoint.Finalize()), 2 * area, area * 1e-4);
+
+  // Overlapping buffers are dissolved
+  S2BufferAggregator overlapping(TestBufferOptions(100000));
+  overlapping.Add(*point0);
+  overlapping.Add(*point2);
+  auto dissolved = overlapping.Finalize();
+  EXPECT_EQ(NumLoops(*dissolved), 1);
+  EXPECT_GT(s2_area(*dissolved), area);
+  EXPECT_LT(s2_area(*dissolved), 2 * area);
+
+  // Merging partial aggregators gives the same result as one aggregator
+  S2BufferAggregator all(TestBufferOptions(100000));
+  S2BufferAggregator partition0(TestBufferOptions(100000));
+  S2BufferAggregator partition1(TestBufferOptions(100000));
+  for (const auto* geog : {point0.get(), point1.get(), point2.get()}) {
+    all.Add(*geog);
+  }
+  all.Add(*line);
+  partition0.Add(*point0);
+  partition0.Add(*line);
+  partition1.Add(*point1);
+  partition1.Add(*point2);
+  partition0.Merge(std::move(partition1));
+
+  auto expected = all.Finalize();
+  auto actual = partition0.Finalize();
+  EXPECT_NEAR(s2_area(*actual), s2_area(*expected),
+              s2_area(*expected) * 1e-4);
+  EXPECT_EQ(NumLoops(*actual), NumLoops(*expected));
+
+  // Finalized or merged aggregators can't be reused
+  EXPECT_THROW(partition0.Finalize(), Exception);
+  EXPECT_THROW(partition0.Add(*point0), Exception);
+  EXPECT_THROW(partition1.Finalize(), Exception);
+  EXPECT_THROW(partition1.Add(*point0), Exception);
+
+  // Merging a consumed aggregator throws and leaves the target usable
+  S2BufferAggregator fresh(TestBufferOptions(100000));
+  fresh.Add(*point0);
+  EXPECT_THROW(fresh.Merge(std::move(partition1)), Exception);
+  EXPECT_NEAR(s2_area(*fresh.Finalize()), area, area * 1e-4);
+}
+
+TEST(Build, CoverageUnionAggregatorGrouped) {
+  // A 4x4 grid of adjacent squares (i.e., a coverage) spanning several
+  // level 3 cells
+  WKTReader reader;
+  std::vector<std::unique_ptr<Geography>> tiles;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      int x = i * 10;
+      int y = j * 10;
+      std::stringstream ss;
+      ss << "POLYGON ((" << x << " " << y << ", " << x + 10 << " " << y
+         << ", " << x + 10 << " " << y + 10 << ", " << x << " " << y + 10
+         << ", " << x << " " << y << "))";
+      tiles.push_back(reader.read_feature(ss.str()));
+    }
+  }
+
+  S2CoverageUnionAggregator all(GlobalOptions{});
+  S2CoverageUnionAggregator grouped(GlobalOptions{}, /*group_level=*/3,
+                                    /*num_threads=*/4);
+  for (const auto& tile : tiles) {
+    all.Add(*tile);
+    grouped.Add(*tile);
+  }
+
+  auto expected = all.Finalize();
+  auto actual = grouped.Finalize();
+  EXPECT_NEAR(s2_area(*actual), s2_area(*expected), 1e-12);
+  EXPECT_EQ(NumLoops(*actual), 1);
+
+  // Finalizing without input should give empty output
+  S2CoverageUnionAggregator empty(GlobalOptions{}, 3);
+  EXPECT_TRUE(s2_is_empty(*empty.Finalize()));
+
+  EXPECT_THROW(S2CoverageUnionAggregator(GlobalOptions{}, 31), Exception);
+}
+
+TEST(Build, SedonaUdfSubdivide) {
+  // A square with a vertex every degree along each side (160 vertices)
+  std::stringstream ss;
+  ss << "POLYGON ((";
+  for (int i = 0; i < 40; ++i) ss << i << " 0, ";
+  for (int i = 0; i < 40; ++i) ss << "40 " << i << ", ";
+  for (int i = 0; i < 40; ++i) ss << 40 - i << " 40, ";
+  for (int i = 0; i < 40; ++i) ss << "0 " << 40 - i << ", ";
+  ss << "0 0))";
+  std::string large = ss.str();
+  std::string small = "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))";
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::SubdivideKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(&kernel, &impl,
+                                         {ARROW_TYPE_WKB, NANOARROW_TYPE_INT64},
+                                         NANOARROW_TYPE_LIST));
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_INT64},
+      {{small, large, "POLYGON EMPTY", std::nullopt}}, {{16}},
+      out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(out_array->length, 4);
+  ASSERT_EQ(out_array->null_count, 1);
+  auto* offsets = reinterpret_cast<const int32_t*>(out_array->buffers[1]);
+  EXPECT_EQ(offsets[1] - offsets[0], 1);
+  EXPECT_GT(offsets[2] - offsets[1], 1);
+  EXPECT_EQ(offsets[3] - offsets[2], 0);
+  EXPECT_EQ(offsets[4] - offsets[3], 0);
+
+  nanoarrow::UniqueArrayView pieces;
+  ArrowArrayViewInitFromType(pieces.get(), NANOARROW_TYPE_BINARY);
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewSetArray(pieces.get(), out_array->children[0], nullptr));
+
+  WKBReader reader;
+  WKTReader wkt_reader;
+  std::vector<std::string> inputs = {small, large};
+  for (int row = 0; row < 2; ++row) {
+    SCOPED_TRACE("row " + std::to_string(row));
+    double area = 0;
+    for (int32_t i = offsets[row]; i < offsets[row + 1]; ++i) {
+      struct ArrowBufferView bytes =
+          ArrowArrayViewGetBytesUnsafe(pieces.get(), i);
+      auto piece = reader.ReadFeature(bytes.data.as_uint8, bytes.size_bytes);
+      EXPECT_LE(s2_num_points(*piece), 16);
+      area += s2_area(*piece);
+    }
+
+    EXPECT_NEAR(area, s2_area(*wkt_reader.read_feature(inputs[row])), 1e-12);
+  }
+}
+
+TEST(Build, SedonaUdfSubdivideReconstructsInput) {
+  // Points, a line that runs along the equator (which is a cell boundary on
+  // face 0), and ZM rows. The points include (0 0), which is a vertex of the
+  // level 1 cells of face 0, and points on the equator and prime meridian.
+  std::stringstream points;
+  points << "MULTIPOINT (";
+  for (int i = 0; i < 20; ++i) {
+    points << (i > 0 ? ", " : "") << "(" << i << " " << (i % 2 == 0 ? 0 : i)
+           << ")";
+  }
+  points << ", (0 5), (0 -5))";
+
+  std::stringstream line;
+  std::stringstream line_zm;
+  line << "LINESTRING (";
+  line_zm << "LINESTRING ZM (";
+  for (int i = 0; i <= 40; ++i) {
+    line << (i > 0 ? ", " : "") << i << " 0";
+    line_zm << (i > 0 ? ", " : "") << i << " " << i % 3 << " " << i << " 1";
+  }
+  line << ")";
+  line_zm << ")";
+
+  std::string small_zm = "LINESTRING ZM (0 0 1 2, 1 1 3 4)";
+  std::vector<std::string> inputs = {points.str(), line.str(), line_zm.str(),
+                                     small_zm};
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::SubdivideKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(&kernel, &impl,
+                                         {ARROW_TYPE_WKB, NANOARROW_TYPE_INT64},
+                                         NANOARROW_TYPE_LIST));
+
+  std::vector<std::optional<std::string>> input_args(inputs.begin(),
+                                                     inputs.end());
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_INT64}, {input_args}, {{8}},
+      out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(out_array->length, 4);
+  auto* offsets = reinterpret_cast<const int32_t*>(out_array->buffers[1]);
+  nanoarrow::UniqueArrayView pieces;
+  ArrowArrayViewInitFromType(pieces.get(), NANOARROW_TYPE_BINARY);
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewSetArray(pieces.get(), out_array->children[0], nullptr));
+
+  WKBReader reader;
+  WKTReader wkt_reader;
+  for (int row = 0; row < 4; ++row) {
+    SCOPED_TRACE("row " + std::to_string(row));
+    std::unique_ptr<Geography> input = wkt_reader.read_feature(inputs[row]);
+
+    // Pieces don't overlap: points and edges on a boundary between cells are
+    // in exactly one piece
+    std::unique_ptr<Geography> pieces_union =
+        std::make_unique<GeographyCollection>();
+    int64_t num_points = 0;
+    double length = 0;
+    for (int32_t i = offsets[row]; i < offsets[row + 1]; ++i) {
+      struct ArrowBufferView bytes =
+          ArrowArrayViewGetBytesUnsafe(pieces.get(), i);
+      auto piece = reader.ReadFeature(bytes.data.as_uint8, bytes.size_bytes);
+      EXPECT_LE(s2_num_points(*piece), 8);
+      if (s2_dimension(*piece) == 0) {
+        num_points += s2_num_points(*piece);
+      }
+      length += s2_length(*piece);
+
+      std::vector<uint8_t> wkb(bytes.data.as_uint8,
+                               bytes.data.as_uint8 + bytes.size_bytes);
+      std::string wkt = TestGeometry::FromWKB(wkb).ToWKT();
+      if (row == 2) {
+        // Pieces of large input are XY
+        EXPECT_EQ(wkt.find("ZM"), std::string::npos) << wkt;
+      } else if (row == 3) {
+        // Small input is returned as is
+        EXPECT_EQ(wkt, TestGeometry::FromWKT(small_zm).ToWKT());
+      }
+
+      std::unique_ptr<Geography> next_union;
+      {
+        ShapeIndexGeography union_index(*pieces_union);
+        ShapeIndexGeography piece_index(*piece);
+        next_union = s2_boolean_operation(union_index, piece_index,
+                                          S2BooleanOperation::OpType::UNION,
+                                          GlobalOptions());
+      }
+      pieces_union = std::move(next_union);
+    }
+
+    if (row == 0) {
+      EXPECT_EQ(num_points, s2_num_points(*input));
+    } else {
+      EXPECT_NEAR(length, s2_length(*input), 1e-12);
+    }
+
+    ASSERT_NO_FATAL_FAILURE(ExpectEqualAfterSnapping(*pieces_union, *input));
+  }
+
+  EXPECT_EQ(offsets[4] - offsets[3], 1);
+}
+
 TEST(Build, SedonaUdfBufferParams) {
   struct SedonaCScalarKernel kernel;
   s2geography::sedona_udf::BufferParamsKernel(&kernel);
@@ -1223,6 +1794,55 @@ TEST(Build, SedonaUdfBufferParams) {
       out_array.get(), {"POLYGON EMPTY", "POLYGON EMPTY", std::nullopt}));
 }
 
+TEST(Build, SedonaUdfBufferParamsAlternating) {
+  // Options for each (distance, params) are cached; ensure that alternating
+  // between more of them than the cache holds (and NaN distances, which
+  // give a null result) uses the options of the current row
+  std::vector<std::optional<std::string>> geoms;
+  std::vector<std::optional<double>> distances;
+  std::vector<std::optional<std::string>> params;
+  for (int i = 0; i < 24; ++i) {
+    geoms.push_back(i % 2 == 0 ? "POINT (0 0)" : "LINESTRING (0 0, 0.1 0)");
+    distances.push_back(i % 7 == 6 ? NAN : 1000.0 * (1 + i % 5));
+    params.push_back(i % 3 == 0 ? "quad_segs=2" : "");
+  }
+
+  auto execute = [](const std::vector<std::optional<std::string>>& geom_arg,
+                    const std::vector<std::optional<double>>& distance_arg,
+                    const std::vector<std::optional<std::string>>& params_arg,
+                    struct ArrowArray* out) {
+    struct SedonaCScalarKernel kernel;
+    s2geography::sedona_udf::BufferParamsKernel(&kernel);
+    struct SedonaCScalarKernelImpl impl;
+    ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+        &kernel, &impl,
+        {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_STRING},
+        ARROW_TYPE_WKB));
+    ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+        &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_STRING},
+        {geom_arg}, {distance_arg}, {params_arg}, out));
+    impl.release(&impl);
+    kernel.release(&kernel);
+  };
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(execute(geoms, distances, params, out_array.get()));
+  auto actual = ResultWkt(out_array.get());
+  ASSERT_EQ(actual.size(), geoms.size());
+
+  // Each row must match the row computed on its own
+  for (size_t i = 0; i < geoms.size(); ++i) {
+    SCOPED_TRACE("row " + std::to_string(i));
+    nanoarrow::UniqueArray row_array;
+    ASSERT_NO_FATAL_FAILURE(
+        execute({geoms[i]}, {distances[i]}, {params[i]}, row_array.get()));
+    auto expected = ResultWkt(row_array.get());
+    ASSERT_EQ(expected.size(), 1);
+    EXPECT_EQ(actual[i], expected[0]);
+    EXPECT_EQ(actual[i].has_value(), !std::isnan(*distances[i]));
+  }
+}
+
 struct BufferParamsOpParam {
   std::string name;
   std::optional<std::string> input_wkt;
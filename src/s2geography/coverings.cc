@@ -2,12 +2,16 @@
 #include "s2geography/coverings.h"
 
 #include <s2/s2earth.h>
+#include <s2/s2cell_union.h>
 #include <s2/s2edge_crosser.h>
 #include <s2/s2latlng_rect_bounder.h>
 #include <s2/s2region_coverer.h>
 #include <s2/s2shape_index_buffered_region.h>
 
+#include <algorithm>
 #include <cfloat>
+#include <cmath>
+#include <limits>
 
 #include "s2geography/accessors-geog.h"
 #include "s2geography/accessors.h"
@@ -86,6 +90,278 @@ void s2_covering_buffered(const ShapeIndexGeography& geog,
   coverer.GetCovering(region, covering);
 }
 
+namespace {
+
+// The leaf cell containing a representative point of value or
+// S2CellId::None() for an empty value
+S2CellId RepresentativeCellId(const GeoArrowGeography& value,
+                              LatLngRectBounder* bounder) {
+  if (value.is_empty()) {
+    return S2CellId::None();
+  }
+
+  // For points we can skip computing bounds
+  auto pt = value.Point();
+  if (pt) {
+    return S2CellId(*pt);
+  }
+
+  bounder->Clear();
+  bounder->Update(value);
+  S2LatLngRect bounds = bounder->Finish();
+  if (bounds.is_empty()) {
+    return S2CellId::None();
+  }
+
+  return S2CellId(bounds.GetCenter());
+}
+
+// The leaf cell containing a longitude/latitude (in degrees) or
+// S2CellId::None() if either is out of range. This computes the unit vector
+// directly (the same computation as S2LatLng::ToPoint()) such that no
+// intermediate geography or validation of the longitude range is required.
+S2CellId LeafCellIdFromLngLat(double lng, double lat) {
+  if (!std::isfinite(lng) || !(std::abs(lat) <= 90.0)) {
+    return S2CellId::None();
+  }
+
+  double phi = lat * (M_PI / 180.0);
+  double theta = lng * (M_PI / 180.0);
+  double cos_phi = std::cos(phi);
+  return S2CellId(S2Point(std::cos(theta) * cos_phi,
+                          std::sin(theta) * cos_phi, std::sin(phi)));
+}
+
+// Minimum number of unsorted points CellAggregator buffers before folding
+// them into its sorted run of distinct cells. The buffer is also allowed to
+// grow to the size of the run so that the cost of each fold is amortized over
+// at least as many points as the run contains.
+constexpr size_t kCellAggregatorMaxPending = 65536;
+
+}  // namespace
+
+void CellIdPartitioner::Clear() { samples_.clear(); }
+
+void CellIdPartitioner::Add(S2CellId cell_id, double cost) {
+  samples_.emplace_back(cell_id, cost);
+}
+
+void CellIdPartitioner::Add(const GeoArrowGeography& value) {
+  S2CellId cell_id = RepresentativeCellId(value, &bounder_);
+  if (cell_id == S2CellId::None()) {
+    return;
+  }
+
+  Add(cell_id, std::max<double>(1, value.num_edges()));
+}
+
+std::vector<S2CellId> CellIdPartitioner::Finish(int num_partitions) {
+  if (num_partitions < 1) {
+    throw Exception("num_partitions must be >= 1");
+  }
+
+  std::vector<S2CellId> splits;
+  splits.reserve(num_partitions - 1);
+
+  // With nothing to go on, split the curve into equal pieces
+  if (samples_.empty()) {
+    uint64_t curve_length = uint64_t{6} << S2CellId::kPosBits;
+    for (int i = 1; i < num_partitions; i++) {
+      uint64_t pos = curve_length / num_partitions * i;
+      splits.push_back(S2CellId((pos & ~uint64_t{1}) | 1));
+    }
+
+    return splits;
+  }
+
+  std::sort(samples_.begin(), samples_.end(),
+            [](const std::pair<S2CellId, double>& a,
+               const std::pair<S2CellId, double>& b) {
+              return a.first < b.first;
+            });
+
+  double total_cost = 0;
+  for (const auto& sample : samples_) {
+    total_cost += sample.second;
+  }
+
+  // Walk the samples in curve order and start a new partition at the first
+  // sample after the cumulative cost crosses each target. Heavily skewed
+  // input (e.g., many identical cells) may result in repeated split points
+  // (i.e., empty partitions) but never in unsorted ones.
+  double cumulative_cost = 0;
+  size_t i = 0;
+  for (int k = 1; k < num_partitions; k++) {
+    double target = total_cost * k / num_partitions;
+    while (i < samples_.size() && cumulative_cost < target) {
+      cumulative_cost += samples_[i].second;
+      i++;
+    }
+
+    if (i < samples_.size()) {
+      splits.push_back(samples_[i].first);
+    } else {
+      splits.push_back(samples_.back().first.next());
+    }
+  }
+
+  return splits;
+}
+
+int64_t CellIdPartitioner::Partition(const std::vector<S2CellId>& splits,
+                                     S2CellId cell_id) {
+  return std::upper_bound(splits.begin(), splits.end(), cell_id) -
+         splits.begin();
+}
+
+CellAggregator::CellAggregator(int level) : level_(level) {
+  if (level < 0 || level > S2CellId::kMaxLevel) {
+    throw Exception("level must be between 0 and 30");
+  }
+}
+
+void CellAggregator::Clear() {
+  pending_.clear();
+  cells_.clear();
+}
+
+void CellAggregator::Add(S2CellId cell_id, double weight) {
+  if (!cell_id.is_valid()) {
+    return;
+  }
+
+  if (cell_id.level() < level_) {
+    throw Exception("Can't aggregate a cell ID above the aggregation level");
+  }
+
+  pending_.push_back({cell_id.parent(level_), 1, weight});
+  if (pending_.size() >= std::max(kCellAggregatorMaxPending, cells_.size())) {
+    Compact();
+  }
+}
+
+void CellAggregator::Add(const S2Point& pt, double weight) {
+  Add(S2CellId(pt), weight);
+}
+
+void CellAggregator::Add(const GeoArrowGeography& value, double weight) {
+  if (value.is_empty()) {
+    return;
+  }
+
+  if (value.dimension() != 0) {
+    throw Exception("Can't aggregate cells from a non-point geography");
+  }
+
+  const GeoArrowPointShape* points = value.points();
+  for (int i = 0; i < points->num_vertices(); i++) {
+    Add(points->vertex(i), weight);
+  }
+}
+
+void CellAggregator::AddLngLat(const double* lngs, const double* lats,
+                               const double* weights, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    S2CellId cell_id = LeafCellIdFromLngLat(lngs[i], lats[i]);
+    if (cell_id != S2CellId::None()) {
+      Add(cell_id, weights == nullptr ? 1.0 : weights[i]);
+    }
+  }
+}
+
+void CellAggregator::Add(const struct ArrowSchema* type,
+                         const struct ArrowArray* points,
+                         const double* weights) {
+  if (sedona_udf::GeoArrowPointInputView::Matches(type)) {
+    sedona_udf::GeoArrowPointInputView view(type);
+    view.SetArray(points, points->length);
+    for (int64_t i = 0; i < points->length; i++) {
+      if (view.IsNull(i)) {
+        continue;
+      }
+
+      internal::GeoArrowVertex pt = view.Get(i);
+      S2CellId cell_id = LeafCellIdFromLngLat(pt.lng, pt.lat);
+      if (cell_id != S2CellId::None()) {
+        Add(cell_id, weights == nullptr ? 1.0 : weights[i]);
+      }
+    }
+  } else if (sedona_udf::GeoArrowGeographyInputView::Matches(type)) {
+    sedona_udf::GeoArrowGeographyInputView view(type);
+    view.SetArray(points, points->length);
+    for (int64_t i = 0; i < points->length; i++) {
+      if (!view.IsNull(i)) {
+        Add(view.Get(i), weights == nullptr ? 1.0 : weights[i]);
+      }
+    }
+  } else {
+    throw Exception("Expected geoarrow.point or geoarrow.wkb input");
+  }
+}
+
+void CellAggregator::Merge(const CellAggregator& other) {
+  if (other.level_ != level_) {
+    throw Exception("Can't merge cell aggregators with different levels");
+  }
+
+  // Inserting our own cells into pending_ would invalidate the iterators
+  // we insert from, so merging with ourselves doubles every cell instead
+  if (&other == this) {
+    Compact();
+    for (Cell& cell : cells_) {
+      cell.count *= 2;
+      cell.sum *= 2;
+    }
+    return;
+  }
+
+  pending_.insert(pending_.end(), other.cells_.begin(), other.cells_.end());
+  pending_.insert(pending_.end(), other.pending_.begin(),
+                  other.pending_.end());
+  Compact();
+}
+
+std::vector<CellAggregator::Cell> CellAggregator::Finish() {
+  Compact();
+  return cells_;
+}
+
+void CellAggregator::Compact() {
+  if (pending_.empty()) {
+    return;
+  }
+
+  std::sort(pending_.begin(), pending_.end(),
+            [](const Cell& a, const Cell& b) { return a.cell_id < b.cell_id; });
+
+  // Merge the sorted pending cells into the existing run, folding together
+  // entries with the same cell ID
+  std::vector<Cell> merged;
+  merged.reserve(cells_.size() + pending_.size());
+  auto fold = [&merged](const Cell& cell) {
+    if (!merged.empty() && merged.back().cell_id == cell.cell_id) {
+      merged.back().count += cell.count;
+      merged.back().sum += cell.sum;
+    } else {
+      merged.push_back(cell);
+    }
+  };
+
+  auto it = cells_.begin();
+  for (const Cell& cell : pending_) {
+    while (it != cells_.end() && it->cell_id < cell.cell_id) {
+      fold(*it++);
+    }
+    fold(cell);
+  }
+  while (it != cells_.end()) {
+    fold(*it++);
+  }
+
+  cells_ = std::move(merged);
+  pending_.clear();
+}
+
 void LatLngRectBounder::Clear() { bounds_ = S2LatLngRect::Empty(); }
 
 S2LatLngRect LatLngRectBounder::Finish() const { return bounds_; }
@@ -232,10 +508,54 @@ struct CellIdFromPointExec {
   }
 };
 
+// Append the S2CellId of a longitude/latitude (in degrees) at a level
+static void AppendCellIdFromLngLat(double lng, double lat, int64_t level,
+                                   IntOutputBuilder* out) {
+  if (level < 0 || level > S2CellId::kMaxLevel) {
+    out->AppendNull();
+    return;
+  }
+
+  S2CellId id = LeafCellIdFromLngLat(lng, lat);
+  if (id == S2CellId::None()) {
+    out->AppendNull();
+    return;
+  }
+
+  if (level != S2CellId::kMaxLevel) {
+    id = id.parent(static_cast<int>(level));
+  }
+
+  out->Append(static_cast<int64_t>(id.id()));
+}
+
+struct CellIdFromLngLatExec {
+  using arg0_t = DoubleInputView;
+  using arg1_t = DoubleInputView;
+  using arg2_t = IntInputView;
+  using out_t = IntOutputBuilder;
+
+  void Exec(double lng, double lat, int64_t level, out_t* out) {
+    AppendCellIdFromLngLat(lng, lat, level, out);
+  }
+};
+
+struct CellIdFromNativePointExec {
+  using arg0_t = GeoArrowPointInputView;
+  using arg1_t = IntInputView;
+  using out_t = IntOutputBuilder;
+
+  void Exec(arg0_t::c_type pt, int64_t level, out_t* out) {
+    AppendCellIdFromLngLat(pt.lng, pt.lat, level, out);
+  }
+};
+
 struct CoveringCellIdsExec {
   using arg0_t = GeoArrowGeographyInputView;
   using out_t = ListOutputBuilder<IntOutputBuilder>;
 
+  CoveringCellIdsExec() { coverer_.mutable_options()->set_max_cells(8); }
+
   void Exec(arg0_t::c_type value, out_t* out) {
     if (value.is_empty()) {
       out->Append();
@@ -257,7 +577,6 @@ struct CoveringCellIdsExec {
     // This will build a shape index for each item and may be slow.
     // We may want to consider just implementing S2Region for the
     // GeoArrowGeography.
-    coverer_.mutable_options()->set_max_cells(8);
     covering_.clear();
     coverer_.GetCovering(*value.Region(), &covering_);
     for (const S2CellId id : covering_) {
@@ -271,6 +590,160 @@ struct CoveringCellIdsExec {
   S2RegionCoverer coverer_;
 };
 
+// Append the non-null, valid cell IDs of a list element to ids. Invalid
+// cell IDs are skipped because S2CellUnion::Normalize() requires valid input.
+static void AppendValidCellIds(const IntListInputView::c_type& value,
+                               std::vector<S2CellId>* ids) {
+  for (int64_t i = 0; i < value.size(); i++) {
+    if (value.IsNull(i)) {
+      continue;
+    }
+
+    S2CellId id(static_cast<uint64_t>(value[i]));
+    if (id.is_valid()) {
+      ids->push_back(id);
+    }
+  }
+}
+
+static void AppendCellIdList(const std::vector<S2CellId>& ids,
+                             ListOutputBuilder<IntOutputBuilder>* out) {
+  for (const S2CellId id : ids) {
+    out->items().Append(static_cast<int64_t>(id.id()));
+  }
+
+  out->Append();
+}
+
+// Check whether two normalized (i.e., sorted and non-overlapping) cell ID
+// vectors have any cell in common in a single merge-style pass
+static bool NormalizedCellIdsIntersect(const std::vector<S2CellId>& x,
+                                       const std::vector<S2CellId>& y) {
+  auto it_x = x.begin();
+  auto it_y = y.begin();
+  while (it_x != x.end() && it_y != y.end()) {
+    if (it_x->range_max() < it_y->range_min()) {
+      ++it_x;
+    } else if (it_y->range_max() < it_x->range_min()) {
+      ++it_y;
+    } else {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Check whether every cell of normalized y is contained by a cell of
+// normalized x. Because cells of x don't overlap, the only candidate for
+// each cell of y is the first cell of x that does not end before it.
+static bool NormalizedCellIdsContain(const std::vector<S2CellId>& x,
+                                     const std::vector<S2CellId>& y) {
+  auto it_x = x.begin();
+  for (const S2CellId id : y) {
+    while (it_x != x.end() && it_x->range_max() < id.range_min()) {
+      ++it_x;
+    }
+
+    if (it_x == x.end() || !it_x->contains(id)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+struct CellUnionNormalizeExec {
+  using arg0_t = IntListInputView;
+  using out_t = ListOutputBuilder<IntOutputBuilder>;
+
+  void Exec(arg0_t::c_type value, out_t* out) {
+    x_.clear();
+    AppendValidCellIds(value, &x_);
+    S2CellUnion::Normalize(&x_);
+    AppendCellIdList(x_, out);
+  }
+
+  std::vector<S2CellId> x_;
+};
+
+struct CellUnionUnionExec {
+  using arg0_t = IntListInputView;
+  using arg1_t = IntListInputView;
+  using out_t = ListOutputBuilder<IntOutputBuilder>;
+
+  void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
+    x_.clear();
+    AppendValidCellIds(value0, &x_);
+    AppendValidCellIds(value1, &x_);
+    S2CellUnion::Normalize(&x_);
+    AppendCellIdList(x_, out);
+  }
+
+  std::vector<S2CellId> x_;
+};
+
+struct CellUnionIntersectionExec {
+  using arg0_t = IntListInputView;
+  using arg1_t = IntListInputView;
+  using out_t = ListOutputBuilder<IntOutputBuilder>;
+
+  void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
+    x_.clear();
+    AppendValidCellIds(value0, &x_);
+    S2CellUnion::Normalize(&x_);
+    y_.clear();
+    AppendValidCellIds(value1, &y_);
+    S2CellUnion::Normalize(&y_);
+
+    intersection_.clear();
+    S2CellUnion::GetIntersection(x_, y_, &intersection_);
+    AppendCellIdList(intersection_, out);
+  }
+
+  std::vector<S2CellId> x_;
+  std::vector<S2CellId> y_;
+  std::vector<S2CellId> intersection_;
+};
+
+struct CellUnionContainsExec {
+  using arg0_t = IntListInputView;
+  using arg1_t = IntListInputView;
+  using out_t = BoolOutputBuilder;
+
+  void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
+    x_.clear();
+    AppendValidCellIds(value0, &x_);
+    S2CellUnion::Normalize(&x_);
+    y_.clear();
+    AppendValidCellIds(value1, &y_);
+    S2CellUnion::Normalize(&y_);
+    out->Append(NormalizedCellIdsContain(x_, y_));
+  }
+
+  std::vector<S2CellId> x_;
+  std::vector<S2CellId> y_;
+};
+
+struct CellUnionIntersectsExec {
+  using arg0_t = IntListInputView;
+  using arg1_t = IntListInputView;
+  using out_t = BoolOutputBuilder;
+
+  void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
+    x_.clear();
+    AppendValidCellIds(value0, &x_);
+    S2CellUnion::Normalize(&x_);
+    y_.clear();
+    AppendValidCellIds(value1, &y_);
+    S2CellUnion::Normalize(&y_);
+    out->Append(NormalizedCellIdsIntersect(x_, y_));
+  }
+
+  std::vector<S2CellId> x_;
+  std::vector<S2CellId> y_;
+};
+
 struct BoundingBoxExec {
   using arg0_t = GeoArrowGeographyInputView;
   using out_t = StructOutputBuilder<DoubleOutputBuilder, DoubleOutputBuilder,
@@ -300,18 +773,270 @@ struct BoundingBoxExec {
   LatLngRectBounder bounder_;
 };
 
+/// \brief Output builder that collects one sort key per row and emits the
+/// permutation that would sort those keys
+///
+/// Keys are sorted with a stable least-significant-digit radix sort. Null
+/// rows are given the largest possible key such that they sort last while
+/// preserving their input order.
+class SortIndicesOutputBuilder {
+ public:
+  using c_type = uint64_t;
+
+  void InitOutputType(struct ArrowSchema* out) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(out, NANOARROW_TYPE_INT64));
+  }
+
+  void InitOutputTypeWithCrs(struct ArrowSchema* out, const std::string& crs) {
+    S2GEOGRAPHY_UNUSED(crs);
+    InitOutputType(out);
+  }
+
+  void Reserve(int64_t additional_size) {
+    keys_.clear();
+    keys_.reserve(static_cast<size_t>(additional_size));
+  }
+
+  void AppendNull() { Append(std::numeric_limits<uint64_t>::max()); }
+
+  void Append(c_type value) { keys_.push_back(value); }
+
+  int64_t current_length() { return static_cast<int64_t>(keys_.size()); }
+
+  void Finish(struct ArrowArray* out) {
+    Sort();
+
+    nanoarrow::UniqueArray tmp;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayInitFromType(tmp.get(), NANOARROW_TYPE_INT64));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(tmp.get()));
+    struct ArrowBuffer* values = ArrowArrayBuffer(tmp.get(), 1);
+    NANOARROW_THROW_NOT_OK(ArrowBufferResize(
+        values, static_cast<int64_t>(indices_.size() * sizeof(int64_t)),
+        false));
+    auto* values_data = reinterpret_cast<int64_t*>(values->data);
+    for (size_t i = 0; i < indices_.size(); i++) {
+      values_data[i] = static_cast<int64_t>(indices_[i]);
+    }
+
+    tmp->length = static_cast<int64_t>(indices_.size());
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(tmp.get(), nullptr));
+    ArrowArrayMove(tmp.get(), out);
+  }
+
+ private:
+  static constexpr int kRadixBits = 16;
+  static constexpr size_t kRadixSize = size_t{1} << kRadixBits;
+  static constexpr uint64_t kRadixMask = kRadixSize - 1;
+
+  std::vector<uint64_t> keys_;
+  std::vector<uint64_t> keys_scratch_;
+  std::vector<uint32_t> indices_;
+  std::vector<uint32_t> indices_scratch_;
+  std::vector<uint32_t> counts_;
+
+  void Sort() {
+    size_t n = keys_.size();
+    if (n > std::numeric_limits<uint32_t>::max()) {
+      throw Exception("Can't compute sort order for more than 2^32 rows");
+    }
+
+    indices_.resize(n);
+    for (size_t i = 0; i < n; i++) {
+      indices_[i] = static_cast<uint32_t>(i);
+    }
+
+    // Small inputs don't benefit from the histogram passes
+    if (n < 256) {
+      std::stable_sort(
+          indices_.begin(), indices_.end(),
+          [&](uint32_t a, uint32_t b) { return keys_[a] < keys_[b]; });
+      return;
+    }
+
+    keys_scratch_.resize(n);
+    indices_scratch_.resize(n);
+    counts_.resize(kRadixSize);
+
+    for (int shift = 0; shift < 64; shift += kRadixBits) {
+      std::fill(counts_.begin(), counts_.end(), 0);
+      for (uint64_t key : keys_) {
+        ++counts_[(key >> shift) & kRadixMask];
+      }
+
+      // Spatially clustered input often shares high (face/level) bits
+      // or low (trailing) bits for every row, in which case this digit
+      // doesn't change the order.
+      if (counts_[(keys_[0] >> shift) & kRadixMask] == n) {
+        continue;
+      }
+
+      uint32_t offset = 0;
+      for (uint32_t& count : counts_) {
+        uint32_t this_count = count;
+        count = offset;
+        offset += this_count;
+      }
+
+      for (size_t i = 0; i < n; i++) {
+        uint32_t dst = counts_[(keys_[i] >> shift) & kRadixMask]++;
+        keys_scratch_[dst] = keys_[i];
+        indices_scratch_[dst] = indices_[i];
+      }
+
+      keys_.swap(keys_scratch_);
+      indices_.swap(indices_scratch_);
+    }
+  }
+};
+
+struct HilbertOrderExec {
+  using arg0_t = GeoArrowGeographyInputView;
+  using out_t = SortIndicesOutputBuilder;
+
+  void Exec(arg0_t::c_type value, out_t* out) {
+    // The position along the Hilbert curve of the leaf cell containing a
+    // representative point. Empties have no representative point and sort
+    // with nulls.
+    S2CellId cell_id = RepresentativeCellId(value, &bounder_);
+    if (cell_id == S2CellId::None()) {
+      out->AppendNull();
+      return;
+    }
+
+    out->Append(cell_id.id());
+  }
+
+  LatLngRectBounder bounder_;
+};
+
+struct PartitionExec {
+  using arg0_t = GeoArrowGeographyInputView;
+  using out_t = IntOutputBuilder;
+  using options_t = std::vector<S2CellId>;
+
+  void SetOptions(const options_t& splits) { splits_ = splits; }
+
+  void Exec(arg0_t::c_type value, out_t* out) {
+    S2CellId cell_id = RepresentativeCellId(value, &bounder_);
+    if (cell_id == S2CellId::None()) {
+      out->AppendNull();
+      return;
+    }
+
+    out->Append(CellIdPartitioner::Partition(splits_, cell_id));
+  }
+
+  std::vector<S2CellId> splits_;
+  LatLngRectBounder bounder_;
+};
+
+struct PartitionOverlapsExec {
+  using arg0_t = GeoArrowGeographyInputView;
+  using out_t = ListOutputBuilder<IntOutputBuilder>;
+  using options_t = std::vector<S2CellId>;
+
+  PartitionOverlapsExec() { coverer_.mutable_options()->set_max_cells(8); }
+
+  void SetOptions(const options_t& splits) { splits_ = splits; }
+
+  void Exec(arg0_t::c_type value, out_t* out) {
+    // Empties don't overlap any partition
+    if (value.is_empty()) {
+      out->Append();
+      return;
+    }
+
+    // Points can only ever be in one partition
+    auto pt = value.Point();
+    if (pt) {
+      out->items().Append(CellIdPartitioner::Partition(splits_, S2CellId(*pt)));
+      out->Append();
+      return;
+    }
+
+    // Otherwise, each cell in the covering spans a contiguous range of
+    // partitions. Coverings are sorted, so ranges from consecutive cells
+    // only need to be checked against the last partition emitted.
+    covering_.clear();
+    coverer_.GetCovering(*value.Region(), &covering_);
+
+    int64_t last_partition = -1;
+    for (const S2CellId id : covering_) {
+      int64_t lo = CellIdPartitioner::Partition(splits_, id.range_min());
+      int64_t hi = CellIdPartitioner::Partition(splits_, id.range_max());
+      for (int64_t partition = std::max(lo, last_partition + 1);
+           partition <= hi; partition++) {
+        out->items().Append(partition);
+        last_partition = partition;
+      }
+    }
+
+    out->Append();
+  }
+
+  std::vector<S2CellId> splits_;
+  std::vector<S2CellId> covering_;
+  S2RegionCoverer coverer_;
+};
+
 void CellIdFromPointKernel(struct SedonaCScalarKernel* out) {
   InitUnaryKernel<CellIdFromPointExec>(out, "s2_cellidfrompoint");
 }
 
+void CellIdFromLngLatKernel(struct SedonaCScalarKernel* out) {
+  InitTernaryKernel<CellIdFromLngLatExec>(out, "s2_cellidfromlnglat");
+}
+
+void CellIdFromNativePointKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<CellIdFromNativePointExec>(out, "s2_cellidfrompoint");
+}
+
 void CoveringCellIdsKernel(struct SedonaCScalarKernel* out) {
   InitUnaryKernel<CoveringCellIdsExec>(out, "s2_coveringcellids");
 }
 
+void CellUnionNormalizeKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<CellUnionNormalizeExec>(out, "s2_cellunionnormalize");
+}
+
+void CellUnionUnionKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<CellUnionUnionExec>(out, "s2_cellunionunion");
+}
+
+void CellUnionIntersectionKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<CellUnionIntersectionExec>(out,
+                                              "s2_cellunionintersection");
+}
+
+void CellUnionContainsKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<CellUnionContainsExec>(out, "s2_cellunioncontains");
+}
+
+void CellUnionIntersectsKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<CellUnionIntersectsExec>(out, "s2_cellunionintersects");
+}
+
 void BoundingBoxKernel(struct SedonaCScalarKernel* out) {
   InitUnaryKernel<BoundingBoxExec>(out, "st_boundingbox");
 }
 
+void HilbertOrderKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<HilbertOrderExec>(out, "s2_hilbertorder");
+}
+
+void PartitionKernel(struct SedonaCScalarKernel* out,
+                     std::vector<S2CellId> splits) {
+  InitUnaryKernelWithOptions<PartitionExec>(out, "s2_partition",
+                                            std::move(splits));
+}
+
+void PartitionOverlapsKernel(struct SedonaCScalarKernel* out,
+                             std::vector<S2CellId> splits) {
+  InitUnaryKernelWithOptions<PartitionOverlapsExec>(
+      out, "s2_partitionoverlaps", std::move(splits));
+}
+
 }  // namespace sedona_udf
 
 }  // namespace s2geography
@@ -27,6 +27,82 @@ class LatLngRectBounder {
   std::vector<S2Point> scratch_;
 };
 
+/// \brief Choose S2CellId split points that divide a dataset into
+/// partitions of roughly equal cost
+///
+/// Each sample is keyed by the leaf S2CellId of a representative point
+/// (the point itself or the center of its bounding rectangle) and weighted
+/// by a cost (by default the number of edges). Finish() returns
+/// num_partitions - 1 sorted split cell IDs such that partition i covers
+/// the contiguous range of S2CellId space [splits[i - 1], splits[i]).
+class CellIdPartitioner {
+ public:
+  void Clear();
+  void Add(S2CellId cell_id, double cost = 1.0);
+  void Add(const GeoArrowGeography& value);
+  std::vector<S2CellId> Finish(int num_partitions);
+  int64_t num_samples() const { return static_cast<int64_t>(samples_.size()); }
+
+  /// \brief Return the partition containing cell_id given split points
+  /// returned by Finish()
+  static int64_t Partition(const std::vector<S2CellId>& splits,
+                           S2CellId cell_id);
+
+ private:
+  std::vector<std::pair<S2CellId, double>> samples_;
+  LatLngRectBounder bounder_;
+};
+
+/// \brief Count and sum weighted points per S2 cell at a fixed level
+///
+/// Points are keyed by their containing S2CellId at level() and buffered.
+/// When the buffer fills it is sorted and folded into a sorted run of
+/// distinct cells such that memory scales with the number of distinct
+/// cells rather than the number of points. Independent aggregators (e.g.,
+/// one per batch or thread) can be combined with Merge(). Finish() returns
+/// cells sorted by cell ID.
+class CellAggregator {
+ public:
+  struct Cell {
+    S2CellId cell_id;
+    int64_t count;
+    double sum;
+  };
+
+  explicit CellAggregator(int level);
+
+  void Clear();
+  void Add(S2CellId cell_id, double weight = 1.0);
+  void Add(const S2Point& pt, double weight = 1.0);
+
+  /// \brief Add every point of a point or multipoint with the same weight
+  void Add(const GeoArrowGeography& value, double weight = 1.0);
+
+  /// \brief Add longitude/latitude coordinates (in degrees)
+  ///
+  /// weights may be nullptr to weight every point by 1. Coordinates that are
+  /// not finite or whose latitude is out of range are skipped.
+  void AddLngLat(const double* lngs, const double* lats, const double* weights,
+                 int64_t n);
+
+  /// \brief Add the non-null points of a geoarrow.point or geoarrow.wkb array
+  ///
+  /// weights may be nullptr or point to one weight per element of points.
+  void Add(const struct ArrowSchema* type, const struct ArrowArray* points,
+           const double* weights = nullptr);
+
+  void Merge(const CellAggregator& other);
+  std::vector<Cell> Finish();
+  int level() const { return level_; }
+
+ private:
+  void Compact();
+
+  int level_;
+  std::vector<Cell> pending_;
+  std::vector<Cell> cells_;
+};
+
 S2Point s2_point_on_surface(const Geography& geog, S2RegionCoverer& coverer);
 void s2_covering(const Geography& geog, std::vector<S2CellId>* covering,
                  S2RegionCoverer& coverer);
@@ -41,9 +117,51 @@ void s2_covering_buffered(const ShapeIndexGeography& geog,
 namespace sedona_udf {
 
 void CellIdFromPointKernel(struct SedonaCScalarKernel* out);
+
+/// \brief Compute the S2CellId at a level of longitude/latitude columns
+///
+/// Takes longitude and latitude (in degrees) as plain double arguments plus
+/// a level from 0 to 30. Rows with an invalid level or latitude are null.
+void CellIdFromLngLatKernel(struct SedonaCScalarKernel* out);
+
+/// \brief Compute the S2CellId at a level of a native geoarrow.point column
+///
+/// An overload of s2_cellidfrompoint that reads coordinates directly from
+/// separated or interleaved point arrays instead of WKB.
+void CellIdFromNativePointKernel(struct SedonaCScalarKernel* out);
 void CoveringCellIdsKernel(struct SedonaCScalarKernel* out);
+
+/// \brief Cell union algebra over list<int64> columns of cell IDs
+///
+/// Inputs need not be normalized: null items and invalid cell IDs are
+/// ignored and each input is normalized before it is used. List outputs are
+/// normalized (i.e., sorted and non-overlapping).
+void CellUnionNormalizeKernel(struct SedonaCScalarKernel* out);
+void CellUnionUnionKernel(struct SedonaCScalarKernel* out);
+void CellUnionIntersectionKernel(struct SedonaCScalarKernel* out);
+void CellUnionContainsKernel(struct SedonaCScalarKernel* out);
+void CellUnionIntersectsKernel(struct SedonaCScalarKernel* out);
+
 void BoundingBoxKernel(struct SedonaCScalarKernel* out);
 
+/// \brief Compute a permutation that orders rows along the S2 Hilbert curve
+///
+/// Rows are keyed by the leaf S2CellId of a representative point (the point
+/// itself or the center of its bounding rectangle) such that taking the
+/// output indices of the input groups spatially nearby rows together. Null
+/// and empty rows sort last in their original order.
+void HilbertOrderKernel(struct SedonaCScalarKernel* out);
+
+/// \brief Assign each row to the partition containing its representative
+/// point given split points computed by a CellIdPartitioner
+void PartitionKernel(struct SedonaCScalarKernel* out,
+                     std::vector<S2CellId> splits);
+
+/// \brief Assign each row to all partitions intersecting its covering
+/// given split points computed by a CellIdPartitioner
+void PartitionOverlapsKernel(struct SedonaCScalarKernel* out,
+                             std::vector<S2CellId> splits);
+
 }  // namespace sedona_udf
 
 }  // namespace s2geography
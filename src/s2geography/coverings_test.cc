@@ -4,8 +4,11 @@
 #include <s2/s2cell_id.h>
 #include <s2/s2latlng.h>
 
+#include <algorithm>
+#include <cmath>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "s2geography/geoarrow-geography.h"
 #include "s2geography/sedona_udf/sedona_udf_test_internal.h"
@@ -218,6 +221,87 @@ TEST(Coverings, SedonaUdfCellIdFromPointArray) {
        std::nullopt, std::nullopt}));
 }
 
+TEST(Coverings, SedonaUdfCellIdFromLngLat) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::CellIdFromLngLatKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl,
+      {NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_INT32},
+      NANOARROW_TYPE_INT64));
+
+  S2CellId id_origin(S2LatLng::FromDegrees(0, 0).ToPoint());
+  S2CellId id_level10(S2LatLng::FromDegrees(45, -120).ToPoint());
+  id_level10 = id_level10.parent(10);
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl,
+      {NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_INT32}, {},
+      {{0, -120, 0, 0, std::nullopt},
+       {0, 45, 91, 0, 0},
+       {30, 10, 30, 31, 30}},
+      out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+      out_array.get(), NANOARROW_TYPE_INT64,
+      {static_cast<double>(id_origin.id()),
+       static_cast<double>(id_level10.id()), std::nullopt, std::nullopt,
+       std::nullopt}));
+}
+
+TEST(Coverings, SedonaUdfCellIdFromNativePoint) {
+  S2CellId id_origin(S2LatLng::FromDegrees(0, 0).ToPoint());
+  S2CellId id_level10(S2LatLng::FromDegrees(45, -120).ToPoint());
+  id_level10 = id_level10.parent(10);
+
+  for (auto point_type :
+       {GEOARROW_TYPE_POINT, GEOARROW_TYPE_INTERLEAVED_POINT}) {
+    SCOPED_TRACE(point_type);
+    struct SedonaCScalarKernel kernel;
+    s2geography::sedona_udf::CellIdFromNativePointKernel(&kernel);
+    struct SedonaCScalarKernelImpl impl;
+    kernel.new_impl(&kernel, &impl);
+
+    nanoarrow::UniqueSchema arg0;
+    geoarrow::GeometryDataType::Make(point_type)
+        .WithEdgeType(GEOARROW_EDGE_TYPE_SPHERICAL)
+        .InitSchema(arg0.get());
+    auto arg1 = std::move(ArgSchemas({NANOARROW_TYPE_INT32})[0]);
+    const struct ArrowSchema* arg_types[] = {arg0.get(), arg1.get()};
+
+    nanoarrow::UniqueSchema out;
+    ASSERT_EQ(impl.init(&impl, arg_types, nullptr, 2, out.get()), NANOARROW_OK)
+        << impl.get_last_error(&impl);
+
+    // Convert WKT to the native point representation
+    auto wkt =
+        ArgArrowString({"POINT (0 0)", "POINT (-120 45)", "POINT EMPTY"});
+    geoarrow::ArrayReader wkt_reader(GEOARROW_TYPE_WKT);
+    wkt_reader.SetArray(wkt.get());
+    geoarrow::ArrayWriter point_writer(point_type);
+    ASSERT_EQ(wkt_reader.Visit(point_writer.visitor(), 0, 3), GEOARROW_OK);
+    nanoarrow::UniqueArray points;
+    point_writer.Finish(points.get());
+
+    auto levels = ArgArrow(NANOARROW_TYPE_INT32, {30, 10, 30});
+    struct ArrowArray* args[] = {points.get(), levels.get()};
+
+    nanoarrow::UniqueArray out_array;
+    ASSERT_EQ(impl.execute(&impl, args, 2, 3, out_array.get()), NANOARROW_OK)
+        << impl.get_last_error(&impl);
+    impl.release(&impl);
+    kernel.release(&kernel);
+
+    ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+        out_array.get(), NANOARROW_TYPE_INT64,
+        {static_cast<double>(id_origin.id()),
+         static_cast<double>(id_level10.id()), std::nullopt}));
+  }
+}
+
 TEST(Coverings, SedonaUdfCoveringCellIdsArray) {
   struct SedonaCScalarKernel kernel;
   s2geography::sedona_udf::CoveringCellIdsKernel(&kernel);
@@ -273,6 +357,176 @@ TEST(Coverings, SedonaUdfCoveringCellIdsArray) {
   kernel.release(&kernel);
 }
 
+using CellIdList = std::optional<std::vector<S2CellId>>;
+
+void InitCellIdListSchema(struct ArrowSchema* schema) {
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_LIST));
+  NANOARROW_THROW_NOT_OK(
+      ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT64));
+}
+
+nanoarrow::UniqueArray ArgCellIdLists(const std::vector<CellIdList>& values) {
+  nanoarrow::UniqueSchema schema;
+  InitCellIdListSchema(schema.get());
+  nanoarrow::UniqueArray array;
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+  for (const auto& value : values) {
+    if (!value) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendNull(array.get(), 1));
+      continue;
+    }
+
+    for (const S2CellId id : *value) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendInt(
+          array->children[0], static_cast<int64_t>(id.id())));
+    }
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishElement(array.get()));
+  }
+
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), nullptr));
+  return array;
+}
+
+std::vector<CellIdList> ReadCellIdLists(struct ArrowArray* array) {
+  nanoarrow::UniqueSchema schema;
+  InitCellIdListSchema(schema.get());
+  nanoarrow::UniqueArrayView view;
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(view.get(), array, nullptr));
+
+  std::vector<CellIdList> out;
+  for (int64_t i = 0; i < array->length; i++) {
+    if (ArrowArrayViewIsNull(view.get(), i)) {
+      out.push_back(std::nullopt);
+      continue;
+    }
+
+    std::vector<S2CellId> ids;
+    int64_t start = ArrowArrayViewListChildOffset(view.get(), i);
+    int64_t end = ArrowArrayViewListChildOffset(view.get(), i + 1);
+    for (int64_t j = start; j < end; j++) {
+      ids.emplace_back(static_cast<uint64_t>(
+          ArrowArrayViewGetIntUnsafe(view->children[0], j)));
+    }
+    out.push_back(std::move(ids));
+  }
+
+  return out;
+}
+
+void ExecuteCellUnionKernel(void (*init_kernel)(struct SedonaCScalarKernel*),
+                            const std::vector<std::vector<CellIdList>>& args,
+                            struct ArrowArray* out) {
+  struct SedonaCScalarKernel kernel;
+  init_kernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  kernel.new_impl(&kernel, &impl);
+
+  std::vector<nanoarrow::UniqueSchema> schemas(args.size());
+  std::vector<const struct ArrowSchema*> schema_ptrs;
+  std::vector<nanoarrow::UniqueArray> arrays;
+  std::vector<struct ArrowArray*> array_ptrs;
+  for (size_t i = 0; i < args.size(); i++) {
+    InitCellIdListSchema(schemas[i].get());
+    schema_ptrs.push_back(schemas[i].get());
+    arrays.push_back(ArgCellIdLists(args[i]));
+    array_ptrs.push_back(arrays.back().get());
+  }
+
+  nanoarrow::UniqueSchema out_type;
+  ASSERT_EQ(impl.init(&impl, schema_ptrs.data(), nullptr,
+                      static_cast<int64_t>(schema_ptrs.size()), out_type.get()),
+            NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_EQ(impl.execute(&impl, array_ptrs.data(),
+                         static_cast<int64_t>(array_ptrs.size()),
+                         arrays[0]->length, out),
+            NANOARROW_OK)
+      << impl.get_last_error(&impl);
+
+  impl.release(&impl);
+  kernel.release(&kernel);
+}
+
+TEST(Coverings, SedonaUdfCellUnionNormalize) {
+  S2CellId face0 = S2CellId::FromFace(0);
+  S2CellId face1 = S2CellId::FromFace(1);
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(ExecuteCellUnionKernel(
+      s2geography::sedona_udf::CellUnionNormalizeKernel,
+      {{std::vector<S2CellId>{face0.child(3), face0.child(0), face0.child(1),
+                              face0.child(2), S2CellId(0)},
+        std::vector<S2CellId>{face1, face1.child(0), face0.child(0)},
+        std::vector<S2CellId>{}, std::nullopt}},
+      out_array.get()));
+
+  std::vector<CellIdList> expected{std::vector<S2CellId>{face0},
+                                   std::vector<S2CellId>{face0.child(0), face1},
+                                   std::vector<S2CellId>{}, std::nullopt};
+  EXPECT_EQ(ReadCellIdLists(out_array.get()), expected);
+}
+
+TEST(Coverings, SedonaUdfCellUnionUnionIntersection) {
+  S2CellId face0 = S2CellId::FromFace(0);
+  S2CellId face1 = S2CellId::FromFace(1);
+  std::vector<std::vector<CellIdList>> args{
+      {std::vector<S2CellId>{face0.child(0)}, std::vector<S2CellId>{face0},
+       std::nullopt},
+      {std::vector<S2CellId>{face1, face0.child(1)},
+       std::vector<S2CellId>{face1, face0.child(2).child(1)},
+       std::vector<S2CellId>{face0}}};
+
+  nanoarrow::UniqueArray union_array;
+  ASSERT_NO_FATAL_FAILURE(ExecuteCellUnionKernel(
+      s2geography::sedona_udf::CellUnionUnionKernel, args, union_array.get()));
+  std::vector<CellIdList> expected_union{
+      std::vector<S2CellId>{face0.child(0), face0.child(1), face1},
+      std::vector<S2CellId>{face0, face1}, std::nullopt};
+  EXPECT_EQ(ReadCellIdLists(union_array.get()), expected_union);
+
+  nanoarrow::UniqueArray intersection_array;
+  ASSERT_NO_FATAL_FAILURE(ExecuteCellUnionKernel(
+      s2geography::sedona_udf::CellUnionIntersectionKernel, args,
+      intersection_array.get()));
+  std::vector<CellIdList> expected_intersection{
+      std::vector<S2CellId>{}, std::vector<S2CellId>{face0.child(2).child(1)},
+      std::nullopt};
+  EXPECT_EQ(ReadCellIdLists(intersection_array.get()), expected_intersection);
+}
+
+TEST(Coverings, SedonaUdfCellUnionPredicates) {
+  S2CellId face0 = S2CellId::FromFace(0);
+  S2CellId face1 = S2CellId::FromFace(1);
+  std::vector<std::vector<CellIdList>> args{
+      {std::vector<S2CellId>{face0, face1},
+       std::vector<S2CellId>{face0.child(0)},
+       std::vector<S2CellId>{face0.child(0), face0.child(3)},
+       std::vector<S2CellId>{face0}, std::nullopt},
+      {std::vector<S2CellId>{face1.child(2), face0.child(3).child(1)},
+       std::vector<S2CellId>{face0}, std::vector<S2CellId>{face0.child(1)},
+       std::vector<S2CellId>{}, std::vector<S2CellId>{face0}}};
+
+  nanoarrow::UniqueArray contains_array;
+  ASSERT_NO_FATAL_FAILURE(ExecuteCellUnionKernel(
+      s2geography::sedona_udf::CellUnionContainsKernel, args,
+      contains_array.get()));
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+      contains_array.get(), NANOARROW_TYPE_BOOL,
+      {true, false, false, true, std::nullopt}));
+
+  nanoarrow::UniqueArray intersects_array;
+  ASSERT_NO_FATAL_FAILURE(ExecuteCellUnionKernel(
+      s2geography::sedona_udf::CellUnionIntersectsKernel, args,
+      intersects_array.get()));
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+      intersects_array.get(), NANOARROW_TYPE_BOOL,
+      {true, true, false, false, std::nullopt}));
+}
+
 TEST(Coverings, SedonaUdfBoundingBox) {
   struct SedonaCScalarKernel kernel;
   s2geography::sedona_udf::BoundingBoxKernel(&kernel);
@@ -320,3 +574,268 @@ TEST(Coverings, SedonaUdfBoundingBox) {
   impl.release(&impl);
   kernel.release(&kernel);
 }
+
+TEST(Coverings, SedonaUdfHilbertOrder) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::HilbertOrderKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(
+      TestInitKernel(&kernel, &impl, {ARROW_TYPE_WKB}, NANOARROW_TYPE_INT64));
+
+  // Each non-empty row lies on a different cube face, so the order is
+  // determined by the face. The linestring crosses the antimeridian and has
+  // a bounding rectangle centered on face 3.
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB},
+      {{"POINT (90 0)", std::nullopt, "LINESTRING (175 0, -175 0)",
+        "POINT (0 0)", "POINT EMPTY", "POINT (0 90)"}},
+      {}, out_array.get()));
+
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(out_array.get(), NANOARROW_TYPE_INT64,
+                                          {3, 0, 5, 2, 1, 4}));
+
+  // Check enough rows to use the radix sort
+  std::vector<std::optional<std::string>> wkts;
+  std::vector<uint64_t> expected_keys;
+  for (int i = 0; i < 1000; i++) {
+    double lng = -180 + (i * 37 % 360);
+    double lat = -85 + (i * 13 % 170);
+    wkts.push_back("POINT (" + std::to_string(lng) + " " +
+                   std::to_string(lat) + ")");
+    expected_keys.push_back(
+        S2CellId(S2LatLng::FromDegrees(lat, lng).Normalized()).id());
+  }
+
+  std::vector<int64_t> expected(wkts.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    expected[i] = static_cast<int64_t>(i);
+  }
+  std::stable_sort(expected.begin(), expected.end(), [&](int64_t a, int64_t b) {
+    return expected_keys[a] < expected_keys[b];
+  });
+
+  nanoarrow::UniqueArray out_array_large;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(&impl, {ARROW_TYPE_WKB}, {wkts}, {},
+                                            out_array_large.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(out_array_large->length, static_cast<int64_t>(expected.size()));
+  auto* actual = static_cast<const int64_t*>(out_array_large->buffers[1]);
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(actual[i], expected[i]) << "Row " << i;
+  }
+}
+
+TEST(CellIdPartitioner, SplitsByCost) {
+  CellIdPartitioner partitioner;
+  for (int face = 0; face < 4; face++) {
+    partitioner.Add(S2CellId::FromFace(face).child_begin(S2CellId::kMaxLevel));
+  }
+
+  std::vector<S2CellId> splits = partitioner.Finish(2);
+  ASSERT_EQ(splits.size(), 1);
+  EXPECT_EQ(splits[0], S2CellId::FromFace(2).child_begin(S2CellId::kMaxLevel));
+  EXPECT_EQ(CellIdPartitioner::Partition(splits, S2CellId::FromFace(0)), 0);
+  EXPECT_EQ(CellIdPartitioner::Partition(splits, S2CellId::FromFace(1)), 0);
+  EXPECT_EQ(CellIdPartitioner::Partition(splits, S2CellId::FromFace(2)), 1);
+  EXPECT_EQ(CellIdPartitioner::Partition(splits, S2CellId::FromFace(5)), 1);
+
+  // A heavy first sample should end up in its own partition
+  partitioner.Clear();
+  partitioner.Add(S2CellId::FromFace(0).child_begin(S2CellId::kMaxLevel), 3);
+  for (int face = 1; face < 4; face++) {
+    partitioner.Add(S2CellId::FromFace(face).child_begin(S2CellId::kMaxLevel));
+  }
+
+  splits = partitioner.Finish(2);
+  ASSERT_EQ(splits.size(), 1);
+  EXPECT_EQ(splits[0], S2CellId::FromFace(1).child_begin(S2CellId::kMaxLevel));
+}
+
+TEST(CellIdPartitioner, SplitsGeographies) {
+  CellIdPartitioner partitioner;
+  for (const char* wkt :
+       {"POINT (0 0)", "POINT (90 0)", "POINT EMPTY",
+        "LINESTRING (175 0, -175 0)", "POINT (0 90)"}) {
+    auto test_geom = TestGeometry::FromWKT(wkt);
+    GeoArrowGeography geog;
+    geog.Init(test_geom.geom());
+    partitioner.Add(geog);
+  }
+
+  // Empties are not sampled
+  EXPECT_EQ(partitioner.num_samples(), 4);
+
+  std::vector<S2CellId> splits = partitioner.Finish(4);
+  ASSERT_EQ(splits.size(), 3);
+  EXPECT_TRUE(std::is_sorted(splits.begin(), splits.end()));
+  EXPECT_EQ(splits[0].face(), 1);
+  EXPECT_EQ(splits[1].face(), 2);
+  EXPECT_EQ(splits[2].face(), 3);
+}
+
+TEST(CellIdPartitioner, SplitsWithoutSamples) {
+  CellIdPartitioner partitioner;
+  std::vector<S2CellId> splits = partitioner.Finish(6);
+  ASSERT_EQ(splits.size(), 5);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_TRUE(splits[i].is_valid());
+    EXPECT_TRUE(splits[i].is_leaf());
+    EXPECT_EQ(splits[i].face(), i + 1);
+  }
+
+  EXPECT_TRUE(partitioner.Finish(1).empty());
+  EXPECT_THROW(partitioner.Finish(0), Exception);
+}
+
+TEST(CellAggregator, CountsAndSumsPerCell) {
+  CellAggregator aggregator(2);
+  std::vector<double> lngs{0, 0.1, 90, NAN, 0};
+  std::vector<double> lats{0, 0.1, 0, 0, 91};
+  std::vector<double> weights{1, 2, 3, 4, 5};
+  aggregator.AddLngLat(lngs.data(), lats.data(), weights.data(), 5);
+
+  std::vector<CellAggregator::Cell> cells = aggregator.Finish();
+  ASSERT_EQ(cells.size(), 2);
+  EXPECT_EQ(cells[0].cell_id,
+            S2CellId(S2LatLng::FromDegrees(0, 0).ToPoint()).parent(2));
+  EXPECT_EQ(cells[0].count, 2);
+  EXPECT_DOUBLE_EQ(cells[0].sum, 3);
+  EXPECT_EQ(cells[1].cell_id,
+            S2CellId(S2LatLng::FromDegrees(0, 90).ToPoint()).parent(2));
+  EXPECT_EQ(cells[1].count, 1);
+  EXPECT_DOUBLE_EQ(cells[1].sum, 3);
+
+  EXPECT_THROW(aggregator.Add(S2CellId::FromFace(0)), Exception);
+  EXPECT_THROW(CellAggregator(31), Exception);
+
+  aggregator.Clear();
+  EXPECT_TRUE(aggregator.Finish().empty());
+}
+
+TEST(CellAggregator, MergeMatchesSingleAggregator) {
+  // Enough points to fold the pending buffer more than once
+  CellAggregator all(4);
+  CellAggregator left(4);
+  CellAggregator right(4);
+  for (int i = 0; i < 200000; i++) {
+    double lng = (i % 3600) / 10.0 - 180;
+    double lat = (i % 1700) / 10.0 - 85;
+    all.AddLngLat(&lng, &lat, nullptr, 1);
+    if (i % 2 == 0) {
+      left.AddLngLat(&lng, &lat, nullptr, 1);
+    } else {
+      right.AddLngLat(&lng, &lat, nullptr, 1);
+    }
+  }
+
+  left.Merge(right);
+  std::vector<CellAggregator::Cell> expected = all.Finish();
+  std::vector<CellAggregator::Cell> actual = left.Finish();
+  ASSERT_EQ(actual.size(), expected.size());
+
+  int64_t total_count = 0;
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(actual[i].cell_id, expected[i].cell_id);
+    EXPECT_EQ(actual[i].count, expected[i].count);
+    EXPECT_DOUBLE_EQ(actual[i].sum, expected[i].sum);
+    total_count += actual[i].count;
+  }
+
+  EXPECT_EQ(total_count, 200000);
+  EXPECT_THROW(all.Merge(CellAggregator(5)), Exception);
+}
+
+TEST(CellAggregator, MergeWithSelf) {
+  // Cells both in the sorted run and pending are doubled
+  CellAggregator aggregator(2);
+  aggregator.Add(S2LatLng::FromDegrees(0, 0).ToPoint(), 1);
+  aggregator.Finish();
+  aggregator.Add(S2LatLng::FromDegrees(0, 0.1).ToPoint(), 2);
+  aggregator.Add(S2LatLng::FromDegrees(0, 90).ToPoint(), 3);
+
+  aggregator.Merge(aggregator);
+  std::vector<CellAggregator::Cell> cells = aggregator.Finish();
+  ASSERT_EQ(cells.size(), 2);
+  EXPECT_EQ(cells[0].count, 4);
+  EXPECT_DOUBLE_EQ(cells[0].sum, 6);
+  EXPECT_EQ(cells[1].count, 2);
+  EXPECT_DOUBLE_EQ(cells[1].sum, 6);
+}
+
+TEST(CellAggregator, AddArrowArray) {
+  auto schema = std::move(ArgSchemas({ARROW_TYPE_WKB})[0]);
+  auto points = ArgWkb({"MULTIPOINT ((0 0), (0.1 0.1))", std::nullopt,
+                        "POINT EMPTY", "POINT (90 0)"});
+  std::vector<double> weights{1, 100, 100, 3};
+
+  CellAggregator aggregator(2);
+  aggregator.Add(schema.get(), points.get(), weights.data());
+  std::vector<CellAggregator::Cell> cells = aggregator.Finish();
+  ASSERT_EQ(cells.size(), 2);
+  EXPECT_EQ(cells[0].count, 2);
+  EXPECT_DOUBLE_EQ(cells[0].sum, 2);
+  EXPECT_EQ(cells[1].count, 1);
+  EXPECT_DOUBLE_EQ(cells[1].sum, 3);
+
+  auto lines = ArgWkb({"LINESTRING (0 0, 1 1)"});
+  EXPECT_THROW(aggregator.Add(schema.get(), lines.get()), Exception);
+}
+
+TEST(Coverings, SedonaUdfPartition) {
+  std::vector<S2CellId> splits = {S2CellId::FromFace(2).range_min()};
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::PartitionKernel(&kernel, splits);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(
+      TestInitKernel(&kernel, &impl, {ARROW_TYPE_WKB}, NANOARROW_TYPE_INT64));
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB},
+      {{"POINT (0 0)", "POINT (0 90)", "LINESTRING (0 89, 10 89)",
+        "POINT EMPTY", std::nullopt}},
+      {}, out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(out_array.get(), NANOARROW_TYPE_INT64,
+                                          {0, 1, 1, std::nullopt, std::nullopt}));
+}
+
+TEST(Coverings, SedonaUdfPartitionOverlaps) {
+  std::vector<S2CellId> splits = {S2CellId::FromFace(2).range_min()};
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::PartitionOverlapsKernel(&kernel, splits);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(
+      TestInitKernel(&kernel, &impl, {ARROW_TYPE_WKB}, NANOARROW_TYPE_LIST));
+
+  // The linestring crosses from face 0 onto face 2 and should be assigned
+  // to both partitions
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB},
+      {{"POINT (0 0)", "LINESTRING (0 0, 0 80)", "POINT EMPTY", std::nullopt}},
+      {}, out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(out_array->length, 4);
+  EXPECT_EQ(out_array->null_count, 1);
+  auto* offsets = reinterpret_cast<const int32_t*>(out_array->buffers[1]);
+  ASSERT_EQ(offsets[1] - offsets[0], 1);
+  ASSERT_EQ(offsets[2] - offsets[1], 2);
+  EXPECT_EQ(offsets[3] - offsets[2], 0);
+  EXPECT_EQ(offsets[4] - offsets[3], 0);
+
+  auto* partitions =
+      reinterpret_cast<const int64_t*>(out_array->children[0]->buffers[1]);
+  EXPECT_EQ(partitions[0], 0);
+  EXPECT_EQ(partitions[1], 0);
+  EXPECT_EQ(partitions[2], 1);
+}
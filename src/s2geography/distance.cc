@@ -540,35 +540,41 @@ bool BothSmallWithoutPolygons(const GeoArrowGeography& value0,
              kMaxBruteForceEdgeComparisons;
 }
 
+// Returns the strategy used such that it can be recorded by the caller
 template <typename Traits>
-void DistanceLine(const GeoArrowGeography& value0,
-                  const GeoArrowGeography& value1, EdgePair* out, int flags,
-                  S1ChordAngle max_distance = S1ChordAngle::Infinity()) {
+ExecStrategy DistanceLine(
+    const GeoArrowGeography& value0, const GeoArrowGeography& value1,
+    EdgePair* out, int flags,
+    S1ChordAngle max_distance = S1ChordAngle::Infinity()) {
   if (value0.is_empty() || value1.is_empty()) {
     *out = {};
-    return;
+    return ExecStrategy::kTrivial;
   }
 
   auto maybe_point0 = value0.Point();
   auto maybe_point1 = value1.Point();
   if (maybe_point0 && maybe_point1) {
     ClearanceLineFromPoints(*maybe_point0, *maybe_point1, out);
-    return;
+    return ExecStrategy::kPoint;
   } else if (maybe_point0 && IsAlreadyIndexedOrLargeOrHasPolygons(value1)) {
     DistanceLineUsingShapeIndexAndPoint<Traits>(
         value1.ShapeIndex(), *maybe_point0, out, flags, max_distance);
     std::swap(out->shape_id0, out->shape_id1);
     std::swap(out->edge_id0, out->edge_id1);
     std::swap(out->extremal_points.first, out->extremal_points.second);
+    return ExecStrategy::kPoint;
   } else if (maybe_point1 && IsAlreadyIndexedOrLargeOrHasPolygons(value0)) {
     DistanceLineUsingShapeIndexAndPoint<Traits>(
         value0.ShapeIndex(), *maybe_point1, out, flags, max_distance);
+    return ExecStrategy::kPoint;
   } else if (BothSmallWithoutPolygons(value0, value1)) {
     DistanceLineOnlyEdgesBruteForce<Traits>(value0, value1, out);
+    return ExecStrategy::kBruteForce;
   } else if (IsAlreadyIndexedOrLargeOrHasPolygons(value0) &&
              HasNoPolygons(value1)) {
     DistanceLineOnlyEdgesSemiBruteForce<Traits>(value0.ShapeIndex(), value1,
                                                 out, flags, max_distance);
+    return ExecStrategy::kSemiIndexed;
   } else if (IsAlreadyIndexedOrLargeOrHasPolygons(value1) &&
              HasNoPolygons(value0)) {
     DistanceLineOnlyEdgesSemiBruteForce<Traits>(value1.ShapeIndex(), value0,
@@ -576,13 +582,15 @@ void DistanceLine(const GeoArrowGeography& value0,
     std::swap(out->shape_id0, out->shape_id1);
     std::swap(out->edge_id0, out->edge_id1);
     std::swap(out->extremal_points.first, out->extremal_points.second);
+    return ExecStrategy::kSemiIndexed;
   } else {
     DistanceLineUsingShapeIndex<Traits>(
         value0.ShapeIndex(), value1.ShapeIndex(), out, flags, max_distance);
+    return ExecStrategy::kShapeIndex;
   }
 }
 
-struct S2ClosestPointExec {
+struct S2ClosestPointExec : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = GeoArrowOutputBuilder;
@@ -594,8 +602,8 @@ struct S2ClosestPointExec {
     // contained and only contains XY values),
     out->SetDimensions(value0.dimensions());
 
-    DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
-                                    kFlagComputePoints);
+    Record(DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
+                                           kFlagComputePoints));
     if (edge_pair_.is_empty()) {
       out->AppendEmpty(GEOARROW_GEOMETRY_TYPE_POINT);
       return;
@@ -617,14 +625,14 @@ struct S2ClosestPointExec {
   EdgePair edge_pair_;
 };
 
-struct S2DistanceExec {
+struct S2DistanceExec : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = DoubleOutputBuilder;
 
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
-    DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
-                                    kFlagComputeDistance);
+    Record(DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
+                                           kFlagComputeDistance));
     if (edge_pair_.is_empty()) {
       out->AppendNull();
     } else {
@@ -635,14 +643,14 @@ struct S2DistanceExec {
   EdgePair edge_pair_;
 };
 
-struct S2MaxDistanceExec {
+struct S2MaxDistanceExec : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = DoubleOutputBuilder;
 
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
-    DistanceLine<MaxDistanceTraits>(value0, value1, &edge_pair_,
-                                    kFlagComputeDistance);
+    Record(DistanceLine<MaxDistanceTraits>(value0, value1, &edge_pair_,
+                                           kFlagComputeDistance));
     if (edge_pair_.is_empty()) {
       out->AppendNull();
     } else {
@@ -653,7 +661,7 @@ struct S2MaxDistanceExec {
   EdgePair edge_pair_;
 };
 
-struct S2ShortestLineExec {
+struct S2ShortestLineExec : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = GeoArrowOutputBuilder;
@@ -663,8 +671,8 @@ struct S2ShortestLineExec {
     // use the common dimensions as the output dimensionality
     out->SetDimensionsCommon(value0.dimensions(), value1.dimensions());
 
-    DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
-                                    kFlagComputePoints);
+    Record(DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
+                                           kFlagComputePoints));
     if (edge_pair_.is_empty()) {
       out->AppendEmpty(GEOARROW_GEOMETRY_TYPE_LINESTRING);
       return;
@@ -705,7 +713,7 @@ struct S2ShortestLineExec {
   EdgePair edge_pair_;
 };
 
-struct S2LongestLineExec {
+struct S2LongestLineExec : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = GeoArrowOutputBuilder;
@@ -713,8 +721,8 @@ struct S2LongestLineExec {
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
     out->SetDimensionsCommon(value0.dimensions(), value1.dimensions());
 
-    DistanceLine<MaxDistanceTraits>(value0, value1, &edge_pair_,
-                                    kFlagComputePoints);
+    Record(DistanceLine<MaxDistanceTraits>(value0, value1, &edge_pair_,
+                                           kFlagComputePoints));
     if (edge_pair_.is_empty()) {
       out->AppendEmpty(GEOARROW_GEOMETRY_TYPE_LINESTRING);
       return;
@@ -744,7 +752,7 @@ struct S2LongestLineExec {
 };
 
 template <typename Output>
-struct S2DistanceWithinExec {
+struct S2DistanceWithinExec : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using arg2_t = DoubleInputView;
@@ -753,14 +761,16 @@ struct S2DistanceWithinExec {
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, arg2_t::c_type value2,
             out_t* out) {
     if (value2 < 0.0) {
+      Record(ExecStrategy::kTrivial);
       out->Append(false);
       return;
     }
 
     S1ChordAngle distance_threshold =
         S1ChordAngle::Radians(value2 / S2Earth::RadiusMeters());
-    DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
-                                    kFlagComputeDistance, distance_threshold);
+    Record(DistanceLine<MinDistanceTraits>(value0, value1, &edge_pair_,
+                                           kFlagComputeDistance,
+                                           distance_threshold));
     if (edge_pair_.is_empty()) {
       out->Append(false);
     } else {
@@ -1,9 +1,12 @@
 
 #include "s2geography/linear-referencing.h"
 
+#include <s2/s2closest_edge_query.h>
 #include <s2/s2edge_distances.h>
 
 #include <algorithm>
+#include <cmath>
+#include <utility>
 
 #include "s2geography/accessors.h"
 #include "s2geography/build.h"
@@ -82,13 +85,159 @@ namespace sedona_udf {
 
 static constexpr int kMaxEdgesLinearSearch = 32;
 
+// A single linestring with the cumulative length at each vertex. When the
+// line is a scalar, the cumulative lengths (and, for long lines, a closest
+// edge query on its index) are computed once and reused for every row of
+// the batch such that locating many points along a route line is not
+// O(points x edges).
+class PreparedLine {
+ public:
+  void Init(GeoArrowGeographyInputView* arg) { arg_ = arg; }
+
+  void Update(const GeoArrowGeography& line) {
+    if (arg_ != nullptr && arg_->is_scalar()) {
+      if (arg_->num_arrays() == num_arrays_) {
+        return;
+      }
+
+      num_arrays_ = arg_->num_arrays();
+    } else {
+      num_arrays_ = -1;
+    }
+
+    line_ = &line;
+    query_initialized_ = false;
+
+    S1Angle length_sum;
+    cumulative_lengths_.clear();
+    cumulative_lengths_.push_back(length_sum);
+    line.VisitEdges([&](const S2Shape::Edge& e) {
+      length_sum += S1Angle(e.v0, e.v1);
+      cumulative_lengths_.push_back(length_sum);
+      return true;
+    });
+  }
+
+  int num_edges() const {
+    return static_cast<int>(cumulative_lengths_.size()) - 1;
+  }
+
+  S1Angle length() const { return cumulative_lengths_.back(); }
+
+  S1Angle length_to(int vertex_id) const {
+    return cumulative_lengths_[vertex_id];
+  }
+
+  // Find the edge on which the point at target distance along the line lies
+  int FindEdge(S1Angle target) const {
+    if (num_edges() <= kMaxEdgesLinearSearch) {
+      for (size_t i = 1; i < cumulative_lengths_.size(); ++i) {
+        if (target < cumulative_lengths_[i]) {
+          return static_cast<int>(i) - 1;
+        }
+      }
+
+      return num_edges() - 1;
+    }
+
+    auto it = std::lower_bound(cumulative_lengths_.begin(),
+                               cumulative_lengths_.end(), target);
+    return static_cast<int>(it - cumulative_lengths_.begin()) - 1;
+  }
+
+  // Find the edge containing the point at a fraction along the line and the
+  // fraction along that edge, clamping fraction to [0, 1]. Callers must
+  // handle a NaN fraction, which has no location.
+  std::pair<int, double> Locate(double fraction) const {
+    S2GEOGRAPHY_DCHECK(!std::isnan(fraction));
+    if (fraction <= 0 || length() == S1Angle::Zero()) {
+      return {0, 0.0};
+    } else if (fraction >= 1) {
+      return {num_edges() - 1, 1.0};
+    }
+
+    S1Angle target = fraction * length();
+    int edge_idx = FindEdge(target);
+
+    S1Angle prev_length = length_to(edge_idx);
+    S1Angle edge_length = length_to(edge_idx + 1) - prev_length;
+    if (edge_length == S1Angle::Zero()) {
+      return {edge_idx, 0.0};
+    }
+
+    return {edge_idx, (target - prev_length) / edge_length};
+  }
+
+  // Find the edge closest to pt, preferring the lowest edge id on ties
+  int FindClosestEdge(const S2Point& pt) {
+    // Only build an index for a line that will be queried more than once
+    if (num_arrays_ != -1 && num_edges() > kMaxEdgesLinearSearch) {
+      if (!query_initialized_) {
+        query_.Init(&line_->ShapeIndex());
+        query_initialized_ = true;
+      }
+
+      S2ClosestEdgeQuery::PointTarget target(pt);
+      S2ClosestEdgeQuery::Result closest = query_.FindClosestEdge(&target);
+      if (closest.is_empty()) {
+        return -1;
+      }
+
+      // The query returns whichever closest edge it visits first, so collect
+      // every edge at that distance to choose the same edge as the linear
+      // search below
+      query_.mutable_options()->set_inclusive_max_distance(closest.distance());
+      query_.FindClosestEdges(&target, &results_);
+      query_.mutable_options()->set_max_distance(S1ChordAngle::Infinity());
+
+      int closest_edge_id = closest.edge_id();
+      for (const S2ClosestEdgeQuery::Result& result : results_) {
+        closest_edge_id = std::min(closest_edge_id, result.edge_id());
+      }
+
+      return closest_edge_id;
+    }
+
+    S1Angle min_distance_to_segment = S1Angle::Infinity();
+    int closest_edge_id = -1;
+    int edge_id = -1;
+    line_->VisitEdges([&](const S2Shape::Edge& e) {
+      ++edge_id;
+      S1Angle distance_to_segment = S2::GetDistance(pt, e.v0, e.v1);
+      if (distance_to_segment < min_distance_to_segment) {
+        closest_edge_id = edge_id;
+        min_distance_to_segment = distance_to_segment;
+      }
+
+      return true;
+    });
+
+    return closest_edge_id;
+  }
+
+ private:
+  GeoArrowGeographyInputView* arg_{};
+  int64_t num_arrays_{-1};
+  const GeoArrowGeography* line_{};
+  std::vector<S1Angle> cumulative_lengths_;
+  S2ClosestEdgeQuery query_;
+  std::vector<S2ClosestEdgeQuery::Result> results_;
+  bool query_initialized_{};
+};
+
 struct S2LineInterpolatePointExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = DoubleInputView;
   using out_t = GeoArrowOutputBuilder;
 
+  void Init(arg0_t* arg0, arg1_t* arg1, out_t* out) {
+    S2GEOGRAPHY_UNUSED(arg1);
+    S2GEOGRAPHY_UNUSED(out);
+    line_.Init(arg0);
+  }
+
   void Exec(arg0_t::c_type value0, arg1_t::c_type fraction, out_t* out) {
-    if (value0.is_empty()) {
+    if (value0.is_empty() || std::isnan(fraction)) {
       out->AppendNull();
       return;
     }
@@ -102,14 +251,7 @@ struct S2LineInterpolatePointExec {
     out->SetDimensions(value0.dimensions());
 
     if (fraction <= 0) {
-      internal::GeoArrowVertex pt;
-      value0.lines()->geom().VisitNativeVertices(
-          [&](const internal::GeoArrowVertex& v) {
-            pt = v;
-            return false;
-          });
-
-      out->AppendPoint(pt, value0.dimensions());
+      AppendFirstVertex(value0, out);
       return;
     } else if (fraction >= 1) {
       auto pt = value0.lines()->native_edge(value0.lines()->num_edges() - 1).v1;
@@ -118,61 +260,31 @@ struct S2LineInterpolatePointExec {
       return;
     }
 
-    S1Angle length_sum;
-    cumulative_lengths_.clear();
-    cumulative_lengths_.push_back(length_sum);
-    value0.VisitEdges([&](const S2Shape::Edge& e) {
-      length_sum += S1Angle(e.v0, e.v1);
-      cumulative_lengths_.push_back(length_sum);
-      return true;
-    });
-
-    if (length_sum.radians() == 0) {
-      internal::GeoArrowVertex pt;
-      value0.lines()->geom().VisitNativeVertices(
-          [&](const internal::GeoArrowVertex& v) {
-            pt = v;
-            return false;
-          });
-
-      out->AppendPoint(pt, value0.dimensions());
+    line_.Update(value0);
+    if (line_.length().radians() == 0) {
+      AppendFirstVertex(value0, out);
       return;
     }
 
-    S1Angle target = fraction * length_sum;
-    int num_edges = value0.lines()->num_edges();
-    int edge_idx = 0;
-    if (num_edges <= kMaxEdgesLinearSearch) {
-      for (size_t i = 1; i < cumulative_lengths_.size(); ++i) {
-        if (target < cumulative_lengths_[i]) {
-          edge_idx = static_cast<int>(i) - 1;
-          break;
-        }
-      }
-    } else {
-      auto it = std::lower_bound(cumulative_lengths_.begin(),
-                                 cumulative_lengths_.end(), target);
-      edge_idx = static_cast<int>(it - cumulative_lengths_.begin()) - 1;
-    }
-
-    S1Angle prev_length = cumulative_lengths_[edge_idx];
-    S1Angle next_length = cumulative_lengths_[edge_idx + 1];
-    S1Angle edge_length = next_length - prev_length;
-    double edge_fraction;
-    if (edge_length == S1Angle::Zero()) {
-      edge_fraction = 0;
-    } else {
-      S1Angle remaining = target - prev_length;
-      edge_fraction = remaining / edge_length;
-    }
-
+    auto [edge_idx, edge_fraction] = line_.Locate(fraction);
     auto native_edge = value0.lines()->native_edge(edge_idx);
     auto pt = native_edge.Interpolate(edge_fraction);
 
     out->AppendPoint(pt, value0.dimensions());
   }
 
-  std::vector<S1Angle> cumulative_lengths_;
+  void AppendFirstVertex(arg0_t::c_type value0, out_t* out) {
+    internal::GeoArrowVertex pt;
+    value0.lines()->geom().VisitNativeVertices(
+        [&](const internal::GeoArrowVertex& v) {
+          pt = v;
+          return false;
+        });
+
+    out->AppendPoint(pt, value0.dimensions());
+  }
+
+  PreparedLine line_;
 };
 
 struct S2LineLocatePointExec {
@@ -180,6 +292,12 @@ struct S2LineLocatePointExec {
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = DoubleOutputBuilder;
 
+  void Init(arg0_t* arg0, arg1_t* arg1, out_t* out) {
+    S2GEOGRAPHY_UNUSED(arg1);
+    S2GEOGRAPHY_UNUSED(out);
+    line_.Init(arg0);
+  }
+
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
     if (value0.is_empty() || value1.is_empty()) {
       out->AppendNull();
@@ -199,46 +317,146 @@ struct S2LineLocatePointExec {
 
     S2Point pt = *maybe_point;
 
-    // This section always does a linear search. In theory some of this search
-    // could be reused for a scalar input across multiple query points; however,
-    // it's unclear that this would be a common query pattern.
-    S1Angle min_distance_to_segment = S1Angle::Infinity();
-    int closest_edge_id = -1;
+    line_.Update(value0);
+    if (line_.length() == S1Angle::Zero()) {
+      out->Append(0.0);
+      return;
+    }
 
-    S1Angle length_sum;
-    cumulative_lengths_.clear();
-    cumulative_lengths_.push_back(length_sum);
-    int edge_id = -1;
-    value0.VisitEdges([&](const S2Shape::Edge& e) {
-      ++edge_id;
+    int closest_edge_id = line_.FindClosestEdge(pt);
+    S2GEOGRAPHY_DCHECK_GE(closest_edge_id, 0);
+    S2Shape::Edge e = value0.lines()->edge(closest_edge_id);
+    S2Point pt_on_edge = S2::Project(pt, e.v0, e.v1);
+    S1Angle e_distance(e.v0, pt_on_edge);
+    S1Angle total_distance = line_.length_to(closest_edge_id) + e_distance;
 
-      length_sum += S1Angle(e.v0, e.v1);
-      cumulative_lengths_.push_back(length_sum);
+    out->Append(total_distance / line_.length());
+  }
 
-      S1Angle distance_to_segment = S2::GetDistance(pt, e.v0, e.v1);
-      if (distance_to_segment < min_distance_to_segment) {
-        closest_edge_id = edge_id;
-        min_distance_to_segment = distance_to_segment;
+  PreparedLine line_;
+};
+
+// Interpolate many fractions along the same line, computing cumulative
+// lengths once per row rather than once per fraction
+struct S2LineInterpolatePointsExec {
+  using arg0_t = GeoArrowGeographyInputView;
+  using arg1_t = DoubleListInputView;
+  using out_t = GeoArrowOutputBuilder;
+
+  void Init(arg0_t* arg0, arg1_t* arg1, out_t* out) {
+    S2GEOGRAPHY_UNUSED(arg1);
+    S2GEOGRAPHY_UNUSED(out);
+    line_.Init(arg0);
+  }
+
+  void Exec(arg0_t::c_type value0, arg1_t::c_type fractions, out_t* out) {
+    if (value0.is_empty()) {
+      out->AppendNull();
+      return;
+    }
+
+    if (!value0.points()->is_empty() || !value0.polygons()->is_empty() ||
+        value0.lines()->num_chains() != 1) {
+      throw Exception(
+          "Input to ST_LineInterpolatePoints must be a single linestring");
+    }
+
+    out->SetDimensions(value0.dimensions());
+    line_.Update(value0);
+
+    // Null and NaN fractions are skipped because they have no representation
+    // in a multipoint
+    out->FeatureStart();
+    out->GeomStart(GEOARROW_GEOMETRY_TYPE_MULTIPOINT);
+    for (int64_t i = 0; i < fractions.size(); i++) {
+      if (fractions.IsNull(i) || std::isnan(fractions[i])) {
+        continue;
       }
 
-      return true;
-    });
+      auto [edge_idx, edge_fraction] = line_.Locate(fractions[i]);
+      auto native_edge = value0.lines()->native_edge(edge_idx);
+      out->GeomStart(GEOARROW_GEOMETRY_TYPE_POINT);
+      out->WriteCoord(native_edge.Interpolate(edge_fraction),
+                      value0.dimensions());
+      out->GeomEnd();
+    }
+    out->GeomEnd();
+    out->FeatureEnd();
+  }
 
-    if (length_sum == S1Angle::Zero()) {
-      out->Append(0.0);
+  PreparedLine line_;
+};
+
+struct S2LineSubstringExec {
+  using arg0_t = GeoArrowGeographyInputView;
+  using arg1_t = DoubleInputView;
+  using arg2_t = DoubleInputView;
+  using out_t = GeoArrowOutputBuilder;
+
+  void Init(arg0_t* arg0, arg1_t* arg1, arg2_t* arg2, out_t* out) {
+    S2GEOGRAPHY_UNUSED(arg1);
+    S2GEOGRAPHY_UNUSED(arg2);
+    S2GEOGRAPHY_UNUSED(out);
+    line_.Init(arg0);
+  }
+
+  void Exec(arg0_t::c_type value0, arg1_t::c_type start, arg2_t::c_type end,
+            out_t* out) {
+    if (value0.is_empty() || std::isnan(start) || std::isnan(end)) {
+      out->AppendNull();
       return;
     }
 
-    S2GEOGRAPHY_DCHECK_GE(closest_edge_id, 0);
-    S2Shape::Edge e = value0.lines()->edge(closest_edge_id);
-    S2Point pt_on_edge = S2::Project(pt, e.v0, e.v1);
-    S1Angle e_distance(e.v0, pt_on_edge);
-    S1Angle total_distance = cumulative_lengths_[closest_edge_id] + e_distance;
+    if (!value0.points()->is_empty() || !value0.polygons()->is_empty() ||
+        value0.lines()->num_chains() != 1) {
+      throw Exception("Input to ST_LineSubstring must be a single linestring");
+    }
 
-    out->Append(total_distance / length_sum);
+    if (!(start <= end)) {
+      throw Exception(
+          "Start fraction of ST_LineSubstring must be less than or equal to "
+          "end fraction");
+    }
+
+    out->SetDimensions(value0.dimensions());
+    line_.Update(value0);
+
+    auto [start_edge, start_fraction] = line_.Locate(start);
+    auto [end_edge, end_fraction] = line_.Locate(end);
+    uint8_t dimensions = value0.dimensions();
+
+    // When start and end fall in the same place the output is a degenerate
+    // linestring with two identical vertices
+    out->FeatureStart();
+    out->GeomStart(GEOARROW_GEOMETRY_TYPE_LINESTRING);
+    out->WriteCoord(
+        value0.lines()->native_edge(start_edge).Interpolate(start_fraction),
+        dimensions);
+
+    // Write vertices strictly between start and end, skipping vertices that
+    // coincide with an interpolated start or end
+    int first_vertex = start_edge + 1;
+    if (start_fraction >= 1) {
+      ++first_vertex;
+    }
+
+    int last_vertex = end_edge;
+    if (end_fraction <= 0) {
+      --last_vertex;
+    }
+
+    for (int i = first_vertex; i <= last_vertex; i++) {
+      out->WriteCoord(value0.lines()->native_edge(i - 1).v1, dimensions);
+    }
+
+    out->WriteCoord(
+        value0.lines()->native_edge(end_edge).Interpolate(end_fraction),
+        dimensions);
+    out->GeomEnd();
+    out->FeatureEnd();
   }
 
-  std::vector<S1Angle> cumulative_lengths_;
+  PreparedLine line_;
 };
 
 void LineInterpolatePointKernel(struct SedonaCScalarKernel* out) {
@@ -249,6 +467,15 @@ void LineLocatePointKernel(struct SedonaCScalarKernel* out) {
   InitBinaryKernel<S2LineLocatePointExec>(out, "st_linelocatepoint");
 }
 
+void LineInterpolatePointsKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<S2LineInterpolatePointsExec>(out,
+                                                "st_lineinterpolatepoints");
+}
+
+void LineSubstringKernel(struct SedonaCScalarKernel* out) {
+  InitTernaryKernel<S2LineSubstringExec>(out, "st_linesubstring");
+}
+
 }  // namespace sedona_udf
 
 }  // namespace s2geography
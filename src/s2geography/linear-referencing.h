@@ -13,6 +13,8 @@ namespace sedona_udf {
 
 void LineInterpolatePointKernel(struct SedonaCScalarKernel* out);
 void LineLocatePointKernel(struct SedonaCScalarKernel* out);
+void LineInterpolatePointsKernel(struct SedonaCScalarKernel* out);
+void LineSubstringKernel(struct SedonaCScalarKernel* out);
 
 }  // namespace sedona_udf
 
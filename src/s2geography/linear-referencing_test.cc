@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "nanoarrow/nanoarrow.hpp"
 #include "s2geography/sedona_udf/sedona_udf_test_internal.h"
 
@@ -49,6 +54,218 @@ TEST(LinearReferencing, SedonaUdfLineInterpolatePointArray) {
                         "POINT (0 1.5)", "POINT (0 2)", std::nullopt}));
 }
 
+// Locate points along a line given as a scalar (which is located using its
+// index when it is long) and as an array (which uses a linear search for
+// every row) and check that both give the expected result
+static void TestLocateScalarAndArray(
+    const std::string& line,
+    const std::vector<std::optional<std::string>>& points,
+    const std::vector<double>& expected) {
+  std::vector<std::optional<std::string>> lines(points.size(), line);
+  std::vector<std::vector<double>> results;
+  for (const auto& line_arg :
+       std::vector<std::vector<std::optional<std::string>>>{{line}, lines}) {
+    struct SedonaCScalarKernel kernel;
+    s2geography::sedona_udf::LineLocatePointKernel(&kernel);
+    struct SedonaCScalarKernelImpl impl;
+    ASSERT_NO_FATAL_FAILURE(TestInitKernel(&kernel, &impl,
+                                           {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+                                           NANOARROW_TYPE_DOUBLE));
+
+    // Execute twice to check that state is not reused across batches
+    nanoarrow::UniqueArray out_array;
+    for (int i = 0; i < 2; i++) {
+      out_array.reset();
+      ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+          &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB}, {line_arg, points}, {},
+          out_array.get()));
+    }
+
+    impl.release(&impl);
+    kernel.release(&kernel);
+
+    nanoarrow::UniqueArrayView array_view;
+    ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_DOUBLE);
+    ASSERT_EQ(
+        ArrowArrayViewSetArray(array_view.get(), out_array.get(), nullptr),
+        NANOARROW_OK);
+    std::vector<double> result;
+    for (int64_t i = 0; i < array_view->length; i++) {
+      result.push_back(ArrowArrayViewGetDoubleUnsafe(array_view.get(), i));
+    }
+
+    ASSERT_EQ(result.size(), expected.size());
+    for (size_t i = 0; i < result.size(); i++) {
+      EXPECT_NEAR(result[i], expected[i], 1e-6) << " Element " << i;
+    }
+
+    results.push_back(std::move(result));
+  }
+
+  EXPECT_EQ(results[0], results[1]);
+}
+
+TEST(LinearReferencing, SedonaUdfLongScalarLine) {
+  // A line long enough that a scalar line is located using its index
+  std::string line = "LINESTRING (0 0";
+  for (int i = 1; i <= 100; i++) {
+    line += ", 0 " + std::to_string(i / 100.0);
+  }
+  line += ")";
+
+  ASSERT_NO_FATAL_FAILURE(TestLocateScalarAndArray(
+      line,
+      {"POINT (0 0.255)", "POINT (0.001 0.505)", "POINT (-0.001 0.755)",
+       "POINT (0 -1)", "POINT (0 2)"},
+      {0.255, 0.505, 0.755, 0, 1}));
+}
+
+TEST(LinearReferencing, SedonaUdfLongScalarLineTies) {
+  // A long line that doubles back on itself, such that every point along it
+  // is equally close to an edge on the way out and an edge on the way back.
+  // Both the index and the linear search choose the lowest edge id.
+  std::string line = "LINESTRING (0 0";
+  for (int i = 1; i <= 100; i++) {
+    line += ", 0 " + std::to_string(i / 100.0);
+  }
+  for (int i = 99; i >= 0; i--) {
+    line += ", 0 " + std::to_string(i / 100.0);
+  }
+  line += ")";
+
+  ASSERT_NO_FATAL_FAILURE(TestLocateScalarAndArray(
+      line, {"POINT (0 0.25)", "POINT (0 0.5)", "POINT (0 0.75)"},
+      {0.125, 0.25, 0.375}));
+}
+
+TEST(LinearReferencing, SedonaUdfLongScalarLineNanFraction) {
+  // A NaN fraction has no location along the line and gives a null result,
+  // including for lines long enough to be located using cumulative lengths
+  std::string line = "LINESTRING (0 0";
+  for (int i = 1; i <= 100; i++) {
+    line += ", 0 " + std::to_string(i / 100.0);
+  }
+  line += ")";
+  double nan = std::numeric_limits<double>::quiet_NaN();
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::LineInterpolatePointKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE}, ARROW_TYPE_WKB));
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(
+      TestExecuteKernel(&impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE},
+                        {{line}}, {{0.5, nan}}, out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultGeography(out_array.get(), {"POINT (0 0.5)", std::nullopt}));
+
+  struct SedonaCScalarKernel substring_kernel;
+  s2geography::sedona_udf::LineSubstringKernel(&substring_kernel);
+  struct SedonaCScalarKernelImpl substring_impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &substring_kernel, &substring_impl,
+      {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DOUBLE},
+      ARROW_TYPE_WKB));
+
+  nanoarrow::UniqueArray substring_out;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &substring_impl,
+      {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DOUBLE}, {{line}},
+      {{nan, 0.25}, {0.5, nan}}, substring_out.get()));
+  substring_impl.release(&substring_impl);
+  substring_kernel.release(&substring_kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(substring_out.get(),
+                                              {std::nullopt, std::nullopt}));
+}
+
+TEST(LinearReferencing, SedonaUdfLineInterpolatePoints) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::LineInterpolatePointsKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  kernel.new_impl(&kernel, &impl);
+
+  auto arg0 = std::move(ArgSchemas({ARROW_TYPE_WKB})[0]);
+  nanoarrow::UniqueSchema arg1;
+  ASSERT_EQ(ArrowSchemaInitFromType(arg1.get(), NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(arg1->children[0], NANOARROW_TYPE_DOUBLE),
+            NANOARROW_OK);
+  const struct ArrowSchema* arg_types[] = {arg0.get(), arg1.get()};
+
+  nanoarrow::UniqueSchema out;
+  ASSERT_EQ(impl.init(&impl, arg_types, nullptr, 2, out.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+
+  // [0, 0.25, 0.5, 1.5], [], null, [0.75, null, NaN]
+  nanoarrow::UniqueArray fractions;
+  ASSERT_EQ(ArrowArrayInitFromSchema(fractions.get(), arg1.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(fractions.get()), NANOARROW_OK);
+  for (double fraction : {0.0, 0.25, 0.5, 1.5}) {
+    ASSERT_EQ(ArrowArrayAppendDouble(fractions->children[0], fraction),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishElement(fractions.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(fractions.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(fractions.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(fractions->children[0], 0.75),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(fractions->children[0], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(fractions->children[0],
+                                   std::numeric_limits<double>::quiet_NaN()),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(fractions.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(fractions.get(), nullptr),
+            NANOARROW_OK);
+
+  auto line = ArgWkb({"LINESTRING (0 0, 0 1, 0 2)"});
+  struct ArrowArray* args[] = {line.get(), fractions.get()};
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(impl.execute(&impl, args, 2, 4, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(
+      out_array.get(),
+      {"MULTIPOINT ((0 0), (0 0.5), (0 1), (0 2))", "MULTIPOINT EMPTY",
+       std::nullopt, "MULTIPOINT ((0 1.5))"}));
+}
+
+TEST(LinearReferencing, SedonaUdfLineSubstring) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::LineSubstringKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl,
+      {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DOUBLE},
+      ARROW_TYPE_WKB));
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB, NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DOUBLE},
+      {{"LINESTRING Z (0 0 0, 0 1 10, 0 2 20)"}},
+      {{0, 0.25, 0.5, 0.25, -1, std::nullopt},
+       {1, 0.75, 1, 0.25, 0.5, 1}},
+      out_array.get()));
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(
+      out_array.get(), {"LINESTRING Z (0 0 0, 0 1 10, 0 2 20)",
+                        "LINESTRING Z (0 0.5 5, 0 1 10, 0 1.5 15)",
+                        "LINESTRING Z (0 1 10, 0 2 20)",
+                        "LINESTRING Z (0 0.5 5, 0 0.5 5)",
+                        "LINESTRING Z (0 0 0, 0 1 10)", std::nullopt}));
+}
+
 struct LineLocatePointParam {
   std::string name;
   std::optional<std::string> line;
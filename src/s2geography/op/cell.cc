@@ -1,25 +1,213 @@
 
 #include "s2geography/op/cell.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <string_view>
 
+#include "absl/numeric/bits.h"
 #include "s2/s2cell.h"
 #include "s2/s2cell_id.h"
 #include "s2/s2latlng.h"
+#include "s2geography/macros.h"
 
 namespace s2geography::op::cell {
 
+namespace {
+
+// Bit manipulation equivalents of the S2CellId methods used by the operators
+// below. Unlike the S2CellId methods these are defined for any input (i.e.,
+// they check validity instead of asserting it) and are simple enough that the
+// array loops that use them can be compiled without branches.
+constexpr int kMaxLevel = S2CellId::kMaxLevel;
+constexpr uint64_t kLevelMask = 0x1555555555555555;
+
+inline uint64_t CellLsb(uint64_t id) { return id & (~id + 1); }
+
+inline bool CellIsValid(uint64_t id) {
+  return (id >> S2CellId::kPosBits) < S2CellId::kNumFaces &&
+         (CellLsb(id) & kLevelMask) != 0;
+}
+
+inline int8_t CellLevel(uint64_t id) {
+  int level = kMaxLevel - (absl::countr_zero(id) >> 1);
+  return CellIsValid(id) ? static_cast<int8_t>(level) : -1;
+}
+
+inline uint64_t CellRangeMin(uint64_t id) { return id - (CellLsb(id) - 1); }
+
+inline uint64_t CellRangeMax(uint64_t id) { return id + (CellLsb(id) - 1); }
+
+inline uint64_t CellParent(uint64_t id, int8_t level) {
+  // Negative levels are relative to the level of the cell
+  int cell_level = CellLevel(id);
+  int level_final = level < 0 ? cell_level + level : level;
+  bool valid = cell_level >= 0 && level_final >= 0 && level_final <= cell_level;
+
+  uint64_t lsb = uint64_t{1} << (2 * (kMaxLevel - (valid ? level_final : 0)));
+  return valid ? (id & (~lsb + 1)) | lsb : kCellIdSentinel;
+}
+
+inline bool CellContains(uint64_t id, uint64_t other) {
+  return CellIsValid(id) && CellIsValid(other) && other >= CellRangeMin(id) &&
+         other <= CellRangeMax(id);
+}
+
+inline bool CellIntersects(uint64_t id, uint64_t other) {
+  return CellIsValid(id) && CellIsValid(other) &&
+         CellRangeMin(other) <= CellRangeMax(id) &&
+         CellRangeMax(other) >= CellRangeMin(id);
+}
+
+inline int8_t CellCommonAncestorLevel(uint64_t id, uint64_t other) {
+  // The position of the most significant bit that differs (or of the
+  // larger lsb) maps {0} -> 30, {1,2} -> 29, ..., {59,60} -> 0 and
+  // {61,62,63} -> -1. bits is never zero because the lsb of a valid cell
+  // is non-zero.
+  uint64_t bits = std::max(id ^ other, std::max(CellLsb(id), CellLsb(other)));
+  int msb = 63 - absl::countl_zero(bits);
+  int level = std::max(60 - msb, -1) >> 1;
+  return CellIsValid(id) && CellIsValid(other) ? static_cast<int8_t>(level)
+                                               : -1;
+}
+
+constexpr char kHexDigits[] = "0123456789abcdef";
+
+// Value of each character as a hex digit or 0x10 if it isn't a hex digit
+constexpr std::array<uint8_t, 256> MakeHexTable() {
+  std::array<uint8_t, 256> table{};
+  for (int i = 0; i < 256; i++) {
+    if (i >= '0' && i <= '9') {
+      table[i] = static_cast<uint8_t>(i - '0');
+    } else if (i >= 'a' && i <= 'f') {
+      table[i] = static_cast<uint8_t>(i - 'a' + 10);
+    } else if (i >= 'A' && i <= 'F') {
+      table[i] = static_cast<uint8_t>(i - 'A' + 10);
+    } else {
+      table[i] = 0x10;
+    }
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> kHexTable = MakeHexTable();
+
+inline void EncodeHex(uint64_t value, char* dst) {
+  for (int i = 0; i < 16; i++) {
+    dst[i] = kHexDigits[(value >> (60 - 4 * i)) & 0xf];
+  }
+}
+
+// Writes the token of id to dst, which must have space for kMaxTokenSize
+// bytes even if the token is shorter, and returns its length. All 16 digits
+// are always written such that trimming trailing zeros is just a choice of
+// length. Equivalent to S2CellId::ToToken().
+inline int32_t EncodeToken(uint64_t id, char* dst) {
+  EncodeHex(id, dst);
+  if (id == 0) {
+    dst[0] = 'X';
+    return 1;
+  }
+
+  return 16 - (absl::countr_zero(id) >> 2);
+}
+
+// Equivalent to S2CellId::FromToken(). Invalid characters are accumulated
+// into a single flag instead of returning early such that the loop has no
+// data-dependent branches.
+inline uint64_t DecodeToken(const char* data, int64_t size) {
+  if (size == 0 || size > kMaxTokenSize) {
+    return kCellIdNone;
+  }
+
+  uint64_t id = 0;
+  uint8_t invalid = 0;
+  for (int64_t i = 0; i < size; i++) {
+    uint8_t digit = kHexTable[static_cast<uint8_t>(data[i])];
+    invalid |= digit;
+    id = (id << 4) | (digit & 0xf);
+  }
+
+  id <<= 4 * (kMaxTokenSize - size);
+  return (invalid & 0x10) ? kCellIdNone : id;
+}
+
+// Writes the debug string of id (e.g., 3/0123) to dst, which must have space
+// for kMaxDebugStringSize bytes, and returns its length. Equivalent to
+// S2CellId::ToString().
+inline int32_t EncodeDebugString(uint64_t id, char* dst) {
+  if (!CellIsValid(id)) {
+    std::memcpy(dst, "Invalid: ", 9);
+    EncodeHex(id, dst + 9);
+    return 9 + 16;
+  }
+
+  int level = CellLevel(id);
+  dst[0] = static_cast<char>('0' + (id >> S2CellId::kPosBits));
+  dst[1] = '/';
+  for (int i = 1; i <= level; i++) {
+    uint64_t child = (id >> (2 * (kMaxLevel - i) + 1)) & 3;
+    dst[1 + i] = static_cast<char>('0' + child);
+  }
+
+  return 2 + level;
+}
+
+// Equivalent to S2CellId::FromDebugString()
+inline uint64_t DecodeDebugString(const char* data, int64_t size) {
+  int64_t level = size - 2;
+  if (level < 0 || level > kMaxLevel) {
+    return kCellIdNone;
+  }
+
+  uint64_t face = static_cast<uint8_t>(data[0] - '0');
+  if (face >= S2CellId::kNumFaces || data[1] != '/') {
+    return kCellIdNone;
+  }
+
+  uint64_t id = face << S2CellId::kPosBits;
+  uint8_t invalid = 0;
+  for (int64_t i = 1; i <= level; i++) {
+    uint8_t child = static_cast<uint8_t>(data[1 + i] - '0');
+    invalid |= child;
+    id |= uint64_t{child & 3u} << (2 * (kMaxLevel - i) + 1);
+  }
+
+  if (invalid > 3) {
+    return kCellIdNone;
+  }
+
+  return id | (uint64_t{1} << (2 * (kMaxLevel - level)));
+}
+
+// Fill out[i] with func(i), then zero the elements that are not valid such
+// that the loop calling func() doesn't need to branch on validity
+template <typename T, typename Func>
+void FillArray(int64_t n, T* out, const uint8_t* validity, Func&& func) {
+  for (int64_t i = 0; i < n; i++) {
+    out[i] = func(i);
+  }
+
+  if (validity != nullptr) {
+    for (int64_t i = 0; i < n; i++) {
+      if (!IsValidAt(validity, i)) {
+        out[i] = T{};
+      }
+    }
+  }
+}
+
+}  // namespace
+
 uint64_t FromToken::ExecuteScalar(const std::string_view cell_token) {
-  // This constructor may not work for all s2 versions
-  return S2CellId::FromToken({cell_token.data(), cell_token.size()}).id();
+  return DecodeToken(cell_token.data(), cell_token.size());
 }
 
 uint64_t FromDebugString::ExecuteScalar(const std::string_view debug_string) {
-  // This constructor may not work for all s2 versions
-  return S2CellId::FromDebugString({debug_string.data(), debug_string.size()})
-      .id();
+  return DecodeDebugString(debug_string.data(), debug_string.size());
 }
 
 uint64_t FromPoint::ExecuteScalar(Point point) {
@@ -38,17 +226,17 @@ Point ToPoint::ExecuteScalar(const uint64_t cell_id) {
 }
 
 std::string_view ToToken::ExecuteScalar(const uint64_t cell_id) {
-  last_result_ = S2CellId(cell_id).ToToken();
-  return last_result_;
+  int32_t size = EncodeToken(cell_id, last_result_.data());
+  return {last_result_.data(), static_cast<size_t>(size)};
 }
 
 std::string_view ToDebugString::ExecuteScalar(const uint64_t cell_id) {
-  last_result_ = S2CellId(cell_id).ToString();
-  return last_result_;
+  int32_t size = EncodeDebugString(cell_id, last_result_.data());
+  return {last_result_.data(), static_cast<size_t>(size)};
 }
 
 bool IsValid::ExecuteScalar(const uint64_t cell_id) {
-  return S2CellId(cell_id).is_valid();
+  return CellIsValid(cell_id);
 }
 
 Point CellCenter::ExecuteScalar(const uint64_t cell_id) {
@@ -65,7 +253,7 @@ Point CellVertex::ExecuteScalar(const uint64_t cell_id,
                                 const int8_t vertex_id) {
   S2CellId cell(cell_id);
 
-  if (vertex_id < 0 || !cell.is_valid()) {
+  if (vertex_id < 0 || vertex_id > 3 || !cell.is_valid()) {
     return point::kInvalidPoint;
   }
 
@@ -74,12 +262,15 @@ Point CellVertex::ExecuteScalar(const uint64_t cell_id,
 }
 
 int8_t Level::ExecuteScalar(const uint64_t cell_id) {
-  S2CellId cell(cell_id);
-  if (!cell.is_valid()) {
-    return -1;
-  }
+  return CellLevel(cell_id);
+}
 
-  return static_cast<int8_t>(cell.level());
+uint64_t RangeMin::ExecuteScalar(const uint64_t cell_id) {
+  return CellIsValid(cell_id) ? CellRangeMin(cell_id) : kCellIdSentinel;
+}
+
+uint64_t RangeMax::ExecuteScalar(const uint64_t cell_id) {
+  return CellIsValid(cell_id) ? CellRangeMax(cell_id) : kCellIdSentinel;
 }
 
 double Area::ExecuteScalar(const uint64_t cell_id) {
@@ -101,38 +292,21 @@ double AreaApprox::ExecuteScalar(const uint64_t cell_id) {
 }
 
 uint64_t Parent::ExecuteScalar(const uint64_t cell_id, const int8_t level) {
-  // allow negative numbers to relate to current level
-  S2CellId cell(cell_id);
-  if (!cell.is_valid()) {
-    return kCellIdSentinel;
-  }
-
-  int8_t level_final;
-  int8_t cell_level = static_cast<int8_t>(cell.level());
-  if (level < 0) {
-    level_final = cell_level + level;
-  } else {
-    level_final = level;
-  }
-
-  if (level_final > cell.level() || level_final < 0) {
-    return kCellIdSentinel;
-  } else {
-    return cell.parent(level_final).id();
-  }
+  return CellParent(cell_id, level);
 }
 
 uint64_t Child::ExecuteScalar(const uint64_t cell_id, const int8_t k) {
-  if (k < 0 || k > 3) {
+  S2CellId cell(cell_id);
+  if (k < 0 || k > 3 || !cell.is_valid() || cell.is_leaf()) {
     return kCellIdSentinel;
   }
 
-  return S2CellId(cell_id).child(k).id();
+  return cell.child(k).id();
 }
 
 uint64_t EdgeNeighbor::ExecuteScalar(const uint64_t cell_id, const int8_t k) {
   S2CellId cell(cell_id);
-  if (k < 0 || k > 3) {
+  if (k < 0 || k > 3 || !cell.is_valid()) {
     return kCellIdSentinel;
   }
 
@@ -143,24 +317,13 @@ uint64_t EdgeNeighbor::ExecuteScalar(const uint64_t cell_id, const int8_t k) {
 
 bool Contains::ExecuteScalar(const uint64_t cell_id,
                              const uint64_t cell_id_test) {
-  S2CellId cell(cell_id);
-  S2CellId cell_test(cell_id_test);
-  if (!cell.is_valid() || !cell_test.is_valid()) {
-    return false;
-  }
-
-  return cell.contains(cell_test);
+  return CellContains(cell_id, cell_id_test);
 }
 
 bool MayIntersect::ExecuteScalar(const uint64_t cell_id,
                                  const uint64_t cell_id_test) {
-  S2CellId cell(cell_id);
-  S2CellId cell_test(cell_id_test);
-  if (!cell.is_valid() || !cell_test.is_valid()) {
-    return false;
-  }
-
-  return S2Cell(cell).MayIntersect(S2Cell(cell_test));
+  // Equivalent to S2Cell::MayIntersect() without computing the cell bounds
+  return CellIntersects(cell_id, cell_id_test);
 }
 
 double Distance::ExecuteScalar(const uint64_t cell_id,
@@ -187,13 +350,130 @@ double MaxDistance::ExecuteScalar(const uint64_t cell_id,
 
 int8_t CommonAncestorLevel::ExecuteScalar(const uint64_t cell_id,
                                           const uint64_t cell_id_test) {
-  S2CellId cell(cell_id);
-  S2CellId cell_test(cell_id_test);
-  if (!cell.is_valid() || !cell_test.is_valid()) {
-    return -1;
+  return CellCommonAncestorLevel(cell_id, cell_id_test);
+}
+
+}  // namespace s2geography::op::cell
+
+namespace s2geography::op {
+
+namespace {
+
+template <typename Encode>
+void EncodeStrings(int64_t n, const uint64_t* cell_id, char* data,
+                   int32_t* offsets, const uint8_t* validity, Encode&& encode) {
+  int32_t offset = 0;
+  offsets[0] = 0;
+  for (int64_t i = 0; i < n; i++) {
+    // Rows that are not valid are written but not included in the output
+    int32_t size = encode(cell_id[i], data + offset);
+    offset += IsValidAt(validity, i) ? size : 0;
+    offsets[i + 1] = offset;
   }
+}
 
-  return static_cast<int8_t>(cell.GetCommonAncestorLevel(cell_test));
+template <typename Decode>
+void DecodeStrings(int64_t n, const char* data, const int32_t* offsets,
+                   uint64_t* out, const uint8_t* validity, Decode&& decode) {
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return decode(data + offsets[i], offsets[i + 1] - offsets[i]);
+  });
 }
 
-}  // namespace s2geography::op::cell
+}  // namespace
+
+void ExecuteArray(cell::ToToken* op, int64_t n, const uint64_t* cell_id,
+                  char* data, int32_t* offsets, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  EncodeStrings(n, cell_id, data, offsets, validity, cell::EncodeToken);
+}
+
+void ExecuteArray(cell::ToDebugString* op, int64_t n, const uint64_t* cell_id,
+                  char* data, int32_t* offsets, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  EncodeStrings(n, cell_id, data, offsets, validity, cell::EncodeDebugString);
+}
+
+void ExecuteArray(cell::FromToken* op, int64_t n, const char* data,
+                  const int32_t* offsets, uint64_t* out,
+                  const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  DecodeStrings(n, data, offsets, out, validity, cell::DecodeToken);
+}
+
+void ExecuteArray(cell::FromDebugString* op, int64_t n, const char* data,
+                  const int32_t* offsets, uint64_t* out,
+                  const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  DecodeStrings(n, data, offsets, out, validity, cell::DecodeDebugString);
+}
+
+void ExecuteArray(cell::IsValid* op, int64_t n, const uint64_t* cell_id,
+                  bool* out, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity,
+                  [&](int64_t i) { return cell::CellIsValid(cell_id[i]); });
+}
+
+void ExecuteArray(cell::Level* op, int64_t n, const uint64_t* cell_id,
+                  int8_t* out, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity,
+                  [&](int64_t i) { return cell::CellLevel(cell_id[i]); });
+}
+
+void ExecuteArray(cell::RangeMin* op, int64_t n, const uint64_t* cell_id,
+                  uint64_t* out, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return cell::CellIsValid(cell_id[i]) ? cell::CellRangeMin(cell_id[i])
+                                         : cell::kCellIdSentinel;
+  });
+}
+
+void ExecuteArray(cell::RangeMax* op, int64_t n, const uint64_t* cell_id,
+                  uint64_t* out, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return cell::CellIsValid(cell_id[i]) ? cell::CellRangeMax(cell_id[i])
+                                         : cell::kCellIdSentinel;
+  });
+}
+
+void ExecuteArray(cell::Parent* op, int64_t n, const uint64_t* cell_id,
+                  const int8_t* level, uint64_t* out,
+                  const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return cell::CellParent(cell_id[i], level[i]);
+  });
+}
+
+void ExecuteArray(cell::Contains* op, int64_t n, const uint64_t* cell_id,
+                  const uint64_t* cell_id_test, bool* out,
+                  const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return cell::CellContains(cell_id[i], cell_id_test[i]);
+  });
+}
+
+void ExecuteArray(cell::MayIntersect* op, int64_t n, const uint64_t* cell_id,
+                  const uint64_t* cell_id_test, bool* out,
+                  const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return cell::CellIntersects(cell_id[i], cell_id_test[i]);
+  });
+}
+
+void ExecuteArray(cell::CommonAncestorLevel* op, int64_t n,
+                  const uint64_t* cell_id, const uint64_t* cell_id_test,
+                  int8_t* out, const uint8_t* validity) {
+  S2GEOGRAPHY_UNUSED(op);
+  cell::FillArray(n, out, validity, [&](int64_t i) {
+    return cell::CellCommonAncestorLevel(cell_id[i], cell_id_test[i]);
+  });
+}
+
+}  // namespace s2geography::op
@@ -23,6 +23,12 @@ static constexpr uint64_t kCellIdNone = 0;
 /// \brief Cell identifier that is greater than all other cells
 static constexpr uint64_t kCellIdSentinel = ~uint64_t{0};
 
+/// \brief The maximum number of characters in a cell token
+static constexpr int kMaxTokenSize = 16;
+
+/// \brief The maximum number of characters in a cell debug string
+static constexpr int kMaxDebugStringSize = 32;
+
 /// \brief Create a cell identifier from a token
 class FromToken : public UnaryOp<uint64_t, std::string_view> {
  public:
@@ -53,7 +59,7 @@ class ToToken : public UnaryOp<std::string_view, uint64_t> {
   std::string_view ExecuteScalar(const uint64_t cell_id) override;
 
  private:
-  std::string last_result_;
+  std::array<char, kMaxTokenSize> last_result_;
 };
 
 /// \brief Get the debug string of a cell identifier
@@ -62,7 +68,7 @@ class ToDebugString : public UnaryOp<std::string_view, uint64_t> {
   std::string_view ExecuteScalar(const uint64_t cell_id) override;
 
  private:
-  std::string last_result_;
+  std::array<char, kMaxDebugStringSize> last_result_;
 };
 
 /// \brief Returns true if the ID is a valid cell identifier or false otherwise
@@ -89,6 +95,22 @@ class Level : public UnaryOp<int8_t, uint64_t> {
   int8_t ExecuteScalar(const uint64_t cell_id) override;
 };
 
+/// \brief Calculate the smallest leaf cell identifier contained by a cell
+///
+/// Cells contained by cell_id are exactly those whose identifiers are
+/// between RangeMin and RangeMax (inclusive), which allows containment
+/// to be checked using integer comparisons (e.g., in a range join).
+class RangeMin : public UnaryOp<uint64_t, uint64_t> {
+ public:
+  uint64_t ExecuteScalar(const uint64_t cell_id) override;
+};
+
+/// \brief Calculate the largest leaf cell identifier contained by a cell
+class RangeMax : public UnaryOp<uint64_t, uint64_t> {
+ public:
+  uint64_t ExecuteScalar(const uint64_t cell_id) override;
+};
+
 /// \brief Calculate the area of a given cell
 class Area : public UnaryOp<double, uint64_t> {
  public:
@@ -157,6 +179,58 @@ class CommonAncestorLevel : public BinaryOp<int8_t, uint64_t, uint64_t> {
 
 }  // namespace cell
 
+/// \brief Array versions of cell operators that only require bit manipulation
+///
+/// These overloads are selected over the generic ExecuteArray() and produce
+/// identical output; however, they are implemented as loops that the
+/// compiler can vectorize (i.e., without a function call or branch per
+/// element).
+///
+/// @{
+
+/// \brief Encode tokens or debug strings into an Arrow-style string buffer
+///
+/// data must have space for n * kMaxTokenSize (or n * kMaxDebugStringSize)
+/// bytes and offsets for n + 1 values. Rows that are not valid are written
+/// as empty strings.
+void ExecuteArray(cell::ToToken* op, int64_t n, const uint64_t* cell_id,
+                  char* data, int32_t* offsets,
+                  const uint8_t* validity = nullptr);
+void ExecuteArray(cell::ToDebugString* op, int64_t n, const uint64_t* cell_id,
+                  char* data, int32_t* offsets,
+                  const uint8_t* validity = nullptr);
+
+/// \brief Decode tokens or debug strings from an Arrow-style string buffer
+void ExecuteArray(cell::FromToken* op, int64_t n, const char* data,
+                  const int32_t* offsets, uint64_t* out,
+                  const uint8_t* validity = nullptr);
+void ExecuteArray(cell::FromDebugString* op, int64_t n, const char* data,
+                  const int32_t* offsets, uint64_t* out,
+                  const uint8_t* validity = nullptr);
+
+void ExecuteArray(cell::IsValid* op, int64_t n, const uint64_t* cell_id,
+                  bool* out, const uint8_t* validity = nullptr);
+void ExecuteArray(cell::Level* op, int64_t n, const uint64_t* cell_id,
+                  int8_t* out, const uint8_t* validity = nullptr);
+void ExecuteArray(cell::RangeMin* op, int64_t n, const uint64_t* cell_id,
+                  uint64_t* out, const uint8_t* validity = nullptr);
+void ExecuteArray(cell::RangeMax* op, int64_t n, const uint64_t* cell_id,
+                  uint64_t* out, const uint8_t* validity = nullptr);
+void ExecuteArray(cell::Parent* op, int64_t n, const uint64_t* cell_id,
+                  const int8_t* level, uint64_t* out,
+                  const uint8_t* validity = nullptr);
+void ExecuteArray(cell::Contains* op, int64_t n, const uint64_t* cell_id,
+                  const uint64_t* cell_id_test, bool* out,
+                  const uint8_t* validity = nullptr);
+void ExecuteArray(cell::MayIntersect* op, int64_t n, const uint64_t* cell_id,
+                  const uint64_t* cell_id_test, bool* out,
+                  const uint8_t* validity = nullptr);
+void ExecuteArray(cell::CommonAncestorLevel* op, int64_t n,
+                  const uint64_t* cell_id, const uint64_t* cell_id_test,
+                  int8_t* out, const uint8_t* validity = nullptr);
+
+/// @}
+
 }  // namespace op
 
 }  // namespace s2geography
@@ -5,6 +5,11 @@
 
 #include <cmath>
 #include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "s2/s2cell_id.h"
 
 namespace s2geography::op::cell {
 
@@ -133,4 +138,215 @@ TEST(Cell, CommonAncestorLevel) {
   EXPECT_EQ(Execute<CommonAncestorLevel>(kCellIdSentinel, TestCellId()), -1);
 }
 
+TEST(Cell, RangeMinMax) {
+  uint64_t parent = Execute<Parent>(TestCellId(), 10);
+  EXPECT_LE(Execute<RangeMin>(parent), TestCellId());
+  EXPECT_GE(Execute<RangeMax>(parent), TestCellId());
+  EXPECT_EQ(Execute<Level>(Execute<RangeMin>(parent)), 30);
+  EXPECT_EQ(Execute<Level>(Execute<RangeMax>(parent)), 30);
+  EXPECT_EQ(Execute<RangeMin>(TestCellId()), TestCellId());
+  EXPECT_EQ(Execute<RangeMax>(TestCellId()), TestCellId());
+
+  EXPECT_EQ(Execute<RangeMin>(kCellIdNone), kCellIdSentinel);
+  EXPECT_EQ(Execute<RangeMax>(kCellIdSentinel), kCellIdSentinel);
+}
+
+// The bit manipulation operators must match S2CellId, and the array overloads
+// must match the scalar operators for cells at all levels and invalid ids
+TEST(Cell, ExecuteArrayBitOps) {
+  std::vector<uint64_t> cell_ids;
+  for (int8_t level = 0; level <= 30; level++) {
+    cell_ids.push_back(Execute<Parent>(TestCellId(), level));
+  }
+  cell_ids.push_back(Execute<EdgeNeighbor>(TestCellId(), 0));
+  cell_ids.push_back(kCellIdNone);
+  cell_ids.push_back(kCellIdSentinel);
+  cell_ids.push_back(uint64_t{7} << 61);
+  cell_ids.push_back(TestCellId() ^ 2);
+
+  // Check the scalar operators against S2CellId for valid input
+  for (uint64_t id : cell_ids) {
+    S2CellId cell(id);
+    if (!cell.is_valid()) {
+      continue;
+    }
+
+    EXPECT_EQ(Execute<Level>(id), cell.level());
+    EXPECT_EQ(Execute<RangeMin>(id), cell.range_min().id());
+    EXPECT_EQ(Execute<RangeMax>(id), cell.range_max().id());
+    for (uint64_t other_id : cell_ids) {
+      S2CellId other(other_id);
+      if (!other.is_valid()) {
+        continue;
+      }
+
+      EXPECT_EQ(Execute<Contains>(id, other_id), cell.contains(other));
+      EXPECT_EQ(Execute<MayIntersect>(id, other_id), cell.intersects(other));
+      EXPECT_EQ(Execute<CommonAncestorLevel>(id, other_id),
+                cell.GetCommonAncestorLevel(other));
+    }
+  }
+
+  int64_t n = static_cast<int64_t>(cell_ids.size());
+  std::vector<uint64_t> cell_ids_test(cell_ids.rbegin(), cell_ids.rend());
+  std::vector<int8_t> levels(n);
+  for (int64_t i = 0; i < n; i++) {
+    levels[i] = static_cast<int8_t>(i % 40 - 5);
+  }
+
+  std::unique_ptr<bool[]> out_bool(new bool[n]);
+  std::vector<int8_t> out_int8(n);
+  std::vector<uint64_t> out_uint64(n);
+
+  IsValid is_valid;
+  ExecuteArray(&is_valid, n, cell_ids.data(), out_bool.get());
+  for (int64_t i = 0; i < n; i++) {
+    EXPECT_EQ(out_bool[i], Execute<IsValid>(cell_ids[i])) << i;
+  }
+
+  Level level;
+  ExecuteArray(&level, n, cell_ids.data(), out_int8.data());
+  for (int64_t i = 0; i < n; i++) {
+    EXPECT_EQ(out_int8[i], Execute<Level>(cell_ids[i])) << i;
+  }
+
+  RangeMin range_min;
+  ExecuteArray(&range_min, n, cell_ids.data(), out_uint64.data());
+  for (int64_t i = 0; i < n; i++) {
+    EXPECT_EQ(out_uint64[i], Execute<RangeMin>(cell_ids[i])) << i;
+  }
+
+  RangeMax range_max;
+  ExecuteArray(&range_max, n, cell_ids.data(), out_uint64.data());
+  for (int64_t i = 0; i < n; i++) {
+    EXPECT_EQ(out_uint64[i], Execute<RangeMax>(cell_ids[i])) << i;
+  }
+
+  Parent parent;
+  ExecuteArray(&parent, n, cell_ids.data(), levels.data(), out_uint64.data());
+  for (int64_t i = 0; i < n; i++) {
+    EXPECT_EQ(out_uint64[i], Execute<Parent>(cell_ids[i], levels[i])) << i;
+  }
+
+  for (const auto& ids : {cell_ids, cell_ids_test}) {
+    Contains contains;
+    ExecuteArray(&contains, n, cell_ids.data(), ids.data(), out_bool.get());
+    for (int64_t i = 0; i < n; i++) {
+      EXPECT_EQ(out_bool[i], Execute<Contains>(cell_ids[i], ids[i])) << i;
+    }
+
+    MayIntersect may_intersect;
+    ExecuteArray(&may_intersect, n, cell_ids.data(), ids.data(),
+                 out_bool.get());
+    for (int64_t i = 0; i < n; i++) {
+      EXPECT_EQ(out_bool[i], Execute<MayIntersect>(cell_ids[i], ids[i])) << i;
+    }
+
+    CommonAncestorLevel common_ancestor_level;
+    ExecuteArray(&common_ancestor_level, n, cell_ids.data(), ids.data(),
+                 out_int8.data());
+    for (int64_t i = 0; i < n; i++) {
+      EXPECT_EQ(out_int8[i], Execute<CommonAncestorLevel>(cell_ids[i], ids[i]))
+          << i;
+    }
+  }
+}
+
+// Tokens and debug strings must match S2CellId for cells at all levels
+TEST(Cell, TokenDebugStringMatchesS2) {
+  std::vector<uint64_t> cell_ids = {kCellIdNone, kCellIdSentinel};
+  for (int8_t level = 0; level <= 30; level++) {
+    cell_ids.push_back(Execute<Parent>(TestCellId(), level));
+  }
+
+  for (uint64_t id : cell_ids) {
+    S2CellId cell(id);
+    EXPECT_EQ(ExecuteString<ToToken>(id), cell.ToToken());
+    EXPECT_EQ(ExecuteString<ToDebugString>(id), cell.ToString());
+    EXPECT_EQ(Execute<FromToken>(cell.ToToken()),
+              S2CellId::FromToken(cell.ToToken()).id());
+    if (cell.is_valid()) {
+      EXPECT_EQ(Execute<FromDebugString>(cell.ToString()), id);
+    }
+  }
+
+  EXPECT_EQ(Execute<FromToken>(""), kCellIdNone);
+  EXPECT_EQ(Execute<FromToken>("89c25"), S2CellId::FromToken("89c25").id());
+  EXPECT_EQ(Execute<FromToken>("89C25"), S2CellId::FromToken("89c25").id());
+  EXPECT_EQ(Execute<FromToken>("89g25"), kCellIdNone);
+  EXPECT_EQ(Execute<FromToken>("89c2500000000000a"), kCellIdNone);
+  EXPECT_EQ(Execute<FromDebugString>("6/"), kCellIdNone);
+  EXPECT_EQ(Execute<FromDebugString>("3/0124"), kCellIdNone);
+  EXPECT_EQ(Execute<FromDebugString>("3-012"), kCellIdNone);
+  EXPECT_EQ(Execute<FromDebugString>("3/"), S2CellId::FromFace(3).id());
+}
+
+TEST(Cell, ExecuteArrayTokens) {
+  std::vector<uint64_t> cell_ids = {TestCellId(), kCellIdNone,
+                                    Execute<Parent>(TestCellId(), 3)};
+  int64_t n = static_cast<int64_t>(cell_ids.size());
+  std::vector<char> data(n * kMaxDebugStringSize);
+  std::vector<int32_t> offsets(n + 1);
+
+  // Element 1 is not valid
+  uint8_t validity = 0b101;
+  ToToken to_token;
+  ExecuteArray(&to_token, n, cell_ids.data(), data.data(), offsets.data(),
+               &validity);
+  EXPECT_EQ(std::string(data.data(), offsets[n]),
+            ExecuteString<ToToken>(cell_ids[0]) +
+                ExecuteString<ToToken>(cell_ids[2]));
+  EXPECT_EQ(offsets[1], offsets[2]);
+
+  std::vector<uint64_t> decoded(n);
+  FromToken from_token;
+  ExecuteArray(&from_token, n, data.data(), offsets.data(), decoded.data(),
+               &validity);
+  EXPECT_EQ(decoded, std::vector<uint64_t>({cell_ids[0], 0, cell_ids[2]}));
+
+  ToDebugString to_debug_string;
+  ExecuteArray(&to_debug_string, n, cell_ids.data(), data.data(),
+               offsets.data());
+  EXPECT_EQ(std::string(data.data() + offsets[1], offsets[2] - offsets[1]),
+            ExecuteString<ToDebugString>(kCellIdNone));
+
+  FromDebugString from_debug_string;
+  ExecuteArray(&from_debug_string, n, data.data(), offsets.data(),
+               decoded.data());
+  EXPECT_EQ(decoded, std::vector<uint64_t>({cell_ids[0], kCellIdNone,
+                                            cell_ids[2]}));
+}
+
+TEST(Cell, ExecuteArrayUnary) {
+  std::vector<uint64_t> cell_ids = {
+      TestCellId(), Execute<Parent>(TestCellId(), 5), kCellIdSentinel};
+  std::vector<int8_t> levels(cell_ids.size());
+
+  Level op;
+  op.Init();
+  ExecuteArray(&op, cell_ids.size(), cell_ids.data(), levels.data());
+  EXPECT_EQ(levels, std::vector<int8_t>({30, 5, -1}));
+
+  // Element 1 is not valid and is not passed to the operator
+  uint8_t validity = 0b101;
+  ExecuteArray(&op, cell_ids.size(), cell_ids.data(), levels.data(),
+               &validity);
+  EXPECT_EQ(levels, std::vector<int8_t>({30, 0, -1}));
+}
+
+TEST(Cell, ExecuteArrayBinary) {
+  uint64_t parent = Execute<Parent>(TestCellId(), -1);
+  std::vector<uint64_t> cell_ids = {parent, TestCellId(), kCellIdSentinel};
+  std::vector<uint64_t> cell_ids_test = {TestCellId(), parent, TestCellId()};
+  bool contains[3];
+
+  Contains op;
+  op.Init();
+  ExecuteArray(&op, cell_ids.size(), cell_ids.data(), cell_ids_test.data(),
+               contains);
+  EXPECT_TRUE(contains[0]);
+  EXPECT_FALSE(contains[1]);
+  EXPECT_FALSE(contains[2]);
+}
+
 }  // namespace s2geography::op::cell
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace s2geography {
 
@@ -17,10 +19,10 @@ namespace op {
 /// The general workflow for using an Op class is to (1) create it
 /// with the appropriate options class, (2) call Init() to give
 /// the Op implementation an opportunity to error for invalid Options,
-/// and (3) loop and call ExecuteScalar() where appropriate. Future
-/// extensions to this framework may add an opportunity for operators
-/// to implement a fast path to loop over arrays (or ArrowArrays)
-/// of input.
+/// and (3) loop and call ExecuteScalar() where appropriate. For
+/// contiguous arrays of input, ExecuteArray() performs this loop
+/// for an already initialized operator without a virtual call
+/// per value.
 ///
 /// @{
 
@@ -77,6 +79,67 @@ typename Op::ReturnT Execute(typename Op::ArgType0 arg0,
   return op.ExecuteScalar(arg0, arg1);
 }
 
+/// \brief Check the validity of element i of an Arrow-style validity bitmap
+///
+/// A validity bitmap of nullptr indicates that all elements are valid.
+inline bool IsValidAt(const uint8_t* validity, int64_t i) {
+  return validity == nullptr || (validity[i >> 3] >> (i & 7)) & 1;
+}
+
+/// \brief Execute an initialized unary operator over contiguous input
+///
+/// Writes n values to out, which must have space for n elements. Elements
+/// that are not valid according to validity (an Arrow-style bitmap that
+/// may be nullptr) are not passed to the operator and are set to
+/// ReturnT{}. Calls are qualified with the concrete Op such that they are
+/// not dispatched virtually and may be inlined into the loop.
+template <typename Op>
+void ExecuteArray(Op* op, int64_t n, const typename Op::ArgType0* arg0,
+                  typename Op::ReturnT* out,
+                  const uint8_t* validity = nullptr) {
+  static_assert(!std::is_same_v<typename Op::ReturnT, std::string_view>,
+                "Operators returning std::string_view can't be executed "
+                "into an array");
+
+  if (validity == nullptr) {
+    for (int64_t i = 0; i < n; i++) {
+      out[i] = op->Op::ExecuteScalar(arg0[i]);
+    }
+    return;
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    out[i] = IsValidAt(validity, i) ? op->Op::ExecuteScalar(arg0[i])
+                                    : typename Op::ReturnT{};
+  }
+}
+
+/// \brief Execute an initialized binary operator over contiguous input
+///
+/// Like the unary version, except both arguments must have n elements and
+/// share a single validity bitmap (e.g., the intersection of the validity
+/// of both inputs).
+template <typename Op>
+void ExecuteArray(Op* op, int64_t n, const typename Op::ArgType0* arg0,
+                  const typename Op::ArgType1* arg1, typename Op::ReturnT* out,
+                  const uint8_t* validity = nullptr) {
+  static_assert(!std::is_same_v<typename Op::ReturnT, std::string_view>,
+                "Operators returning std::string_view can't be executed "
+                "into an array");
+
+  if (validity == nullptr) {
+    for (int64_t i = 0; i < n; i++) {
+      out[i] = op->Op::ExecuteScalar(arg0[i], arg1[i]);
+    }
+    return;
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    out[i] = IsValidAt(validity, i) ? op->Op::ExecuteScalar(arg0[i], arg1[i])
+                                    : typename Op::ReturnT{};
+  }
+}
+
 // This overload allow executing functions that return std::string_view,
 // since the regular Execute() will return a view to deleted memory.
 template <typename Op>
@@ -115,7 +115,7 @@ namespace sedona_udf {
 static const int kMaxBruteForceEdges = 32;
 
 template <typename Output>
-struct S2Intersects {
+struct S2Intersects : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = Output;
@@ -127,6 +127,7 @@ struct S2Intersects {
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
     // If either argument is EMPTY, the result is FALSE
     if (value0.is_empty() || value1.is_empty()) {
+      Record(ExecStrategy::kTrivial);
       out->Append(false);
       return;
     }
@@ -137,6 +138,7 @@ struct S2Intersects {
     if (value0.is_unindexed() && value1.is_unindexed() &&
         value0.num_edges() < kMaxBruteForceEdges &&
         value1.num_edges() < kMaxBruteForceEdges) {
+      Record(ExecStrategy::kBruteForce);
       out->Append(BruteForceExec(value0, value1));
       return;
     }
@@ -146,6 +148,10 @@ struct S2Intersects {
     // avoid it.
     auto maybe_point0 = value0.Point();
     auto maybe_point1 = value1.Point();
+    if (maybe_point0 || maybe_point1) {
+      Record(ExecStrategy::kPoint);
+    }
+
     if (maybe_point0 && maybe_point1) {
       out->Append(maybe_point0->Normalize() == maybe_point1->Normalize());
       return;
@@ -179,10 +185,12 @@ struct S2Intersects {
     S2CellUnion::GetIntersection(value0.Covering(), value1.Covering(),
                                  &intersection_);
     if (intersection_.empty()) {
+      Record(ExecStrategy::kCoveringRejection);
       out->Append(false);
       return;
     }
 
+    Record(ExecStrategy::kShapeIndex);
     out->Append(ExecUsingShapeIndex(value0, value1));
   }
 
@@ -291,7 +299,7 @@ struct S2Intersects {
 };
 
 template <typename Output>
-struct S2Contains {
+struct S2Contains : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = Output;
@@ -299,12 +307,17 @@ struct S2Contains {
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
     // If either argument is EMPTY, the result is FALSE
     if (value0.is_empty() || value1.is_empty()) {
+      Record(ExecStrategy::kTrivial);
       out->Append(false);
       return;
     }
 
     auto maybe_point0 = value0.Point();
     auto maybe_point1 = value1.Point();
+    if (maybe_point0 || maybe_point1) {
+      Record(ExecStrategy::kPoint);
+    }
+
     if (maybe_point0) {
       // A point cannot contain anything
       out->Append(false);
@@ -328,6 +341,7 @@ struct S2Contains {
         value0.num_edges() < kMaxBruteForceEdges &&
         value1.num_edges() < kMaxBruteForceEdges &&
         value0.polygons()->num_edges() > 0) {
+      Record(ExecStrategy::kBruteForce);
       out->Append(BruteForceExec(value0, value1));
       return;
     }
@@ -336,6 +350,7 @@ struct S2Contains {
     // check containment using the index's point query and crossing query.
     if (!value0.is_unindexed() && value1.is_unindexed() &&
         value1.num_edges() < kMaxBruteForceEdges) {
+      Record(ExecStrategy::kSemiIndexed);
       out->Append(SemiBruteForceIndexedContains(value0.ShapeIndex(), value1));
       return;
     }
@@ -343,10 +358,12 @@ struct S2Contains {
     S2CellUnion::GetIntersection(value0.Covering(), value1.Covering(),
                                  &intersection_);
     if (intersection_.empty()) {
+      Record(ExecStrategy::kCoveringRejection);
       out->Append(false);
       return;
     }
 
+    Record(ExecStrategy::kShapeIndex);
     out->Append(ExecUsingShapeIndex(value0, value1));
   }
 
@@ -427,6 +444,8 @@ struct S2Within {
     return contains_.Exec(value1, value0, out);
   }
 
+  void SetStats(ExecStats* stats) { contains_.SetStats(stats); }
+
   S2Contains<BoolOutputBuilder> contains_;
 };
 
@@ -445,12 +464,14 @@ struct S2Disjoint {
     intersects_.Exec(value0, value1, &out_);
   }
 
+  void SetStats(ExecStats* stats) { intersects_.SetStats(stats); }
+
   S2Intersects<InvertedOutput> intersects_;
   InvertedOutput out_;
 };
 
 template <typename Output>
-struct S2Equals {
+struct S2Equals : public InstrumentedExec {
   using arg0_t = GeoArrowGeographyInputView;
   using arg1_t = GeoArrowGeographyInputView;
   using out_t = Output;
@@ -462,11 +483,13 @@ struct S2Equals {
   void Exec(arg0_t::c_type value0, arg1_t::c_type value1, out_t* out) {
     // Empties equal each other regardless of exactly how they are empty
     if (value0.is_empty() && value1.is_empty()) {
+      Record(ExecStrategy::kTrivial);
       out->Append(true);
       return;
     }
 
     if (GeographyIdentical(value0, value1)) {
+      Record(ExecStrategy::kTrivial);
       out->Append(true);
       return;
     }
@@ -474,10 +497,12 @@ struct S2Equals {
     S2CellUnion::GetIntersection(value0.Covering(), value1.Covering(),
                                  &intersection_);
     if (intersection_.empty()) {
+      Record(ExecStrategy::kCoveringRejection);
       out->Append(false);
       return;
     }
 
+    Record(ExecStrategy::kShapeIndex);
     out->Append(s2_equals(value0.ShapeIndex(), value1.ShapeIndex(), options_));
   }
 
@@ -0,0 +1,519 @@
+
+#include "s2geography/sedona_udf/cell_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "s2/s2point.h"
+#include "s2geography/op/cell.h"
+#include "s2geography/sedona_udf/sedona_udf_internal.h"
+
+namespace s2geography::sedona_udf {
+
+namespace {
+
+using op::cell::kCellIdNone;
+using op::cell::kCellIdSentinel;
+using op::point::Point;
+
+// Sedona input view and output builder for each op argument/return type
+template <typename T>
+struct OpInputView {
+  using type = IntInputView;
+};
+
+template <>
+struct OpInputView<std::string_view> {
+  using type = StringInputView;
+};
+
+template <typename T>
+struct OpOutputBuilder;
+
+template <>
+struct OpOutputBuilder<uint64_t> {
+  using type = IntOutputBuilder;
+};
+
+template <>
+struct OpOutputBuilder<int8_t> {
+  using type = IntOutputBuilder;
+};
+
+template <>
+struct OpOutputBuilder<bool> {
+  using type = BoolOutputBuilder;
+};
+
+template <>
+struct OpOutputBuilder<double> {
+  using type = DoubleOutputBuilder;
+};
+
+template <>
+struct OpOutputBuilder<std::string_view> {
+  using type = StringOutputBuilder;
+};
+
+template <>
+struct OpOutputBuilder<Point> {
+  using type = GeoArrowOutputBuilder;
+};
+
+template <typename ArgT, typename ValueT>
+ArgT ToOpArg(ValueT value) {
+  if constexpr (std::is_same_v<ArgT, int8_t>) {
+    // Clamp such that out-of-range levels or child positions remain out of
+    // range instead of wrapping around
+    return static_cast<int8_t>(std::clamp<int64_t>(value, INT8_MIN, INT8_MAX));
+  } else {
+    return static_cast<ArgT>(value);
+  }
+}
+
+// Sentinel results for invalid input are returned as null
+inline bool IsNullResult(uint64_t value) {
+  return value == kCellIdNone || value == kCellIdSentinel;
+}
+
+inline bool IsNullResult(int8_t value) { return value < 0; }
+
+inline bool IsNullResult(bool value) {
+  S2GEOGRAPHY_UNUSED(value);
+  return false;
+}
+
+inline bool IsNullResult(double value) { return std::isnan(value); }
+
+void AppendOpResult(IntOutputBuilder* out, uint64_t value) {
+  if (IsNullResult(value)) {
+    out->AppendNull();
+  } else {
+    out->Append(static_cast<int64_t>(value));
+  }
+}
+
+void AppendOpResult(IntOutputBuilder* out, int8_t value) {
+  if (IsNullResult(value)) {
+    out->AppendNull();
+  } else {
+    out->Append(value);
+  }
+}
+
+void AppendOpResult(BoolOutputBuilder* out, bool value) { out->Append(value); }
+
+void AppendOpResult(DoubleOutputBuilder* out, double value) {
+  if (IsNullResult(value)) {
+    out->AppendNull();
+  } else {
+    out->Append(value);
+  }
+}
+
+void AppendOpResult(StringOutputBuilder* out, std::string_view value) {
+  out->Append(value);
+}
+
+void AppendOpResult(GeoArrowOutputBuilder* out, const Point& value) {
+  if (std::isnan(value[0])) {
+    out->AppendNull();
+    return;
+  }
+
+  internal::GeoArrowVertex v;
+  v.SetPoint(S2Point(value[0], value[1], value[2]));
+  out->AppendPoint(v);
+}
+
+// Argument and result types that can be executed a batch at a time by
+// op::ExecuteArray(). Other operators (i.e., those with string or point
+// arguments or results) are executed row by row.
+template <typename T>
+constexpr bool kIsBatchArg =
+    std::is_same_v<T, uint64_t> || std::is_same_v<T, int8_t>;
+
+template <typename T>
+constexpr bool kIsBatchResult =
+    std::is_same_v<T, uint64_t> || std::is_same_v<T, int8_t> ||
+    std::is_same_v<T, bool> || std::is_same_v<T, double>;
+
+// Operators whose string results are encoded a batch at a time directly
+// into the output and the maximum size of each result
+template <typename Op>
+constexpr int64_t kMaxEncodedSize = 0;
+
+template <>
+constexpr int64_t kMaxEncodedSize<op::cell::ToToken> = op::cell::kMaxTokenSize;
+
+template <>
+constexpr int64_t kMaxEncodedSize<op::cell::ToDebugString> =
+    op::cell::kMaxDebugStringSize;
+
+// Operators whose string arguments are decoded a batch at a time directly
+// from the input
+template <typename Op>
+constexpr bool kIsBatchDecode =
+    std::is_same_v<Op, op::cell::FromToken> ||
+    std::is_same_v<Op, op::cell::FromDebugString>;
+
+// Scratch space for a batch of values that, unlike std::vector<bool>, can
+// be written through a bool*
+template <typename T>
+class ScratchArray {
+ public:
+  T* Resize(int64_t n) {
+    if (n > capacity_) {
+      data_.reset(new T[n]);
+      capacity_ = n;
+    }
+
+    return data_.get();
+  }
+
+ private:
+  std::unique_ptr<T[]> data_;
+  int64_t capacity_{};
+};
+
+// Resolve n values of an argument as a contiguous array. Cell identifiers
+// are read directly from the data buffer of (u)int64 input; other
+// argument types are converted into scratch. Scalar arguments are
+// broadcast into scratch. Returns nullptr if the argument can't be read
+// as a contiguous array (in which case the batch is executed row by row).
+template <typename T>
+const T* BatchArg(IntInputView* arg, int64_t n, std::vector<T>* scratch) {
+  const struct ArrowArrayView* view = arg->view();
+  if constexpr (std::is_same_v<T, uint64_t>) {
+    if (view->dictionary != nullptr ||
+        (view->storage_type != NANOARROW_TYPE_INT64 &&
+         view->storage_type != NANOARROW_TYPE_UINT64)) {
+      return nullptr;
+    }
+
+    const uint64_t* values = view->buffer_views[1].data.as_uint64;
+    if (view->length == 1 && n != 1) {
+      scratch->assign(n, values[view->offset]);
+      return scratch->data();
+    }
+
+    return values + view->offset;
+  } else {
+    scratch->resize(n);
+    for (int64_t i = 0; i < n; i++) {
+      (*scratch)[i] = ToOpArg<T>(arg->Get(i));
+    }
+
+    return scratch->data();
+  }
+}
+
+// Combine the validity of the arguments of a batch of n rows into a single
+// bitmap, which is nullptr if no row is null. Returns false if a bitmap
+// doesn't start on a byte boundary and can't be combined without shifting.
+bool BatchValidity(std::initializer_list<const struct ArrowArrayView*> views,
+                   int64_t n, std::vector<uint8_t>* scratch,
+                   const uint8_t** validity) {
+  int64_t num_bytes = (n + 7) / 8;
+  *validity = nullptr;
+  for (const struct ArrowArrayView* view : views) {
+    const uint8_t* bitmap = view->buffer_views[0].data.as_uint8;
+    if (view->null_count == 0 || bitmap == nullptr) {
+      continue;
+    }
+
+    // A null scalar is broadcast to every row
+    if (view->length == 1 && n != 1) {
+      if (ArrowArrayViewIsNull(view, 0)) {
+        scratch->assign(num_bytes, 0);
+        *validity = scratch->data();
+        return true;
+      }
+
+      continue;
+    }
+
+    if (view->offset % 8 != 0) {
+      return false;
+    }
+
+    bitmap += view->offset / 8;
+    if (*validity == nullptr) {
+      *validity = bitmap;
+    } else {
+      if (*validity != scratch->data()) {
+        scratch->assign(*validity, *validity + num_bytes);
+      }
+
+      for (int64_t i = 0; i < num_bytes; i++) {
+        (*scratch)[i] &= bitmap[i];
+      }
+
+      *validity = scratch->data();
+    }
+  }
+
+  return true;
+}
+
+// Append a batch of results computed by op::ExecuteArray(), where rows
+// that are not valid or have a sentinel result are null
+template <typename Builder, typename T>
+void AppendOpResults(Builder* out, int64_t n, const T* results,
+                     const uint8_t* validity) {
+  using storage_t = typename Builder::storage_t;
+  int64_t offset = out->current_length();
+  storage_t* values = out->AppendUninitialized(n);
+  for (int64_t i = 0; i < n; i++) {
+    values[i] = static_cast<storage_t>(results[i]);
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    if (!op::IsValidAt(validity, i) || IsNullResult(results[i])) {
+      out->SetNull(offset + i);
+    }
+  }
+}
+
+// The op is a member of the Exec (initialized once per kernel impl) and
+// calls are qualified with the concrete Op such that the per-row call is
+// not virtual. Batches of operators with integer arguments (and cell
+// token and debug string conversions) are executed directly over the Arrow
+// buffers by op::ExecuteArray().
+template <typename Op>
+struct UnaryOpExec {
+  using arg0_t = typename OpInputView<typename Op::ArgType0>::type;
+  using out_t = typename OpOutputBuilder<typename Op::ReturnT>::type;
+
+  static constexpr bool kBatch = kIsBatchArg<typename Op::ArgType0> &&
+                                 kIsBatchResult<typename Op::ReturnT>;
+
+  void Init(arg0_t* arg0, out_t* out) {
+    S2GEOGRAPHY_UNUSED(arg0);
+    S2GEOGRAPHY_UNUSED(out);
+    op_.Init();
+  }
+
+  bool ExecBatch(arg0_t* arg0, int64_t n, out_t* out) {
+    if constexpr (kBatch) {
+      const auto* values0 = BatchArg(arg0, n, &scratch0_);
+      const uint8_t* validity;
+      if (values0 == nullptr ||
+          !BatchValidity({arg0->view()}, n, &validity_, &validity)) {
+        return false;
+      }
+
+      typename Op::ReturnT* results = results_.Resize(n);
+      op::ExecuteArray(&op_, n, values0, results, validity);
+      AppendOpResults(out, n, results, validity);
+      return true;
+    } else if constexpr (kMaxEncodedSize<Op> > 0) {
+      const uint64_t* values0 = BatchArg(arg0, n, &scratch0_);
+      const uint8_t* validity;
+      if (values0 == nullptr ||
+          !BatchValidity({arg0->view()}, n, &validity_, &validity)) {
+        return false;
+      }
+
+      // Rows that are not valid are encoded as empty strings
+      int64_t offset = out->current_length();
+      out->AppendEncoded(n, n * kMaxEncodedSize<Op>,
+                         [&](char* data, int32_t* offsets) {
+                           op::ExecuteArray(&op_, n, values0, data, offsets,
+                                            validity);
+                         });
+      for (int64_t i = 0; i < n; i++) {
+        if (!op::IsValidAt(validity, i)) {
+          out->SetNull(offset + i);
+        }
+      }
+
+      return true;
+    } else if constexpr (kIsBatchDecode<Op>) {
+      // Only strings with 32-bit offsets are decoded directly
+      const struct ArrowArrayView* view = arg0->view();
+      const uint8_t* validity;
+      if (view->dictionary != nullptr ||
+          (view->storage_type != NANOARROW_TYPE_STRING &&
+           view->storage_type != NANOARROW_TYPE_BINARY) ||
+          view->length != n ||
+          !BatchValidity({view}, n, &validity_, &validity)) {
+        return false;
+      }
+
+      uint64_t* results = results_.Resize(n);
+      op::ExecuteArray(&op_, n, view->buffer_views[2].data.as_char,
+                       view->buffer_views[1].data.as_int32 + view->offset,
+                       results, validity);
+      AppendOpResults(out, n, results, validity);
+      return true;
+    } else {
+      S2GEOGRAPHY_UNUSED(arg0);
+      S2GEOGRAPHY_UNUSED(n);
+      S2GEOGRAPHY_UNUSED(out);
+      return false;
+    }
+  }
+
+  void Exec(typename arg0_t::c_type value0, out_t* out) {
+    AppendOpResult(out, op_.Op::ExecuteScalar(
+                            ToOpArg<typename Op::ArgType0>(value0)));
+  }
+
+  Op op_;
+  std::vector<typename Op::ArgType0> scratch0_;
+  std::vector<uint8_t> validity_;
+  ScratchArray<typename Op::ReturnT> results_;
+};
+
+template <typename Op>
+struct BinaryOpExec {
+  using arg0_t = typename OpInputView<typename Op::ArgType0>::type;
+  using arg1_t = typename OpInputView<typename Op::ArgType1>::type;
+  using out_t = typename OpOutputBuilder<typename Op::ReturnT>::type;
+
+  static constexpr bool kBatch = kIsBatchArg<typename Op::ArgType0> &&
+                                 kIsBatchArg<typename Op::ArgType1> &&
+                                 kIsBatchResult<typename Op::ReturnT>;
+
+  void Init(arg0_t* arg0, arg1_t* arg1, out_t* out) {
+    S2GEOGRAPHY_UNUSED(arg0);
+    S2GEOGRAPHY_UNUSED(arg1);
+    S2GEOGRAPHY_UNUSED(out);
+    op_.Init();
+  }
+
+  bool ExecBatch(arg0_t* arg0, arg1_t* arg1, int64_t n, out_t* out) {
+    if constexpr (kBatch) {
+      const auto* values0 = BatchArg(arg0, n, &scratch0_);
+      const auto* values1 = BatchArg(arg1, n, &scratch1_);
+      const uint8_t* validity;
+      if (values0 == nullptr || values1 == nullptr ||
+          !BatchValidity({arg0->view(), arg1->view()}, n, &validity_,
+                         &validity)) {
+        return false;
+      }
+
+      typename Op::ReturnT* results = results_.Resize(n);
+      op::ExecuteArray(&op_, n, values0, values1, results, validity);
+      AppendOpResults(out, n, results, validity);
+      return true;
+    } else {
+      S2GEOGRAPHY_UNUSED(arg0);
+      S2GEOGRAPHY_UNUSED(arg1);
+      S2GEOGRAPHY_UNUSED(n);
+      S2GEOGRAPHY_UNUSED(out);
+      return false;
+    }
+  }
+
+  void Exec(typename arg0_t::c_type value0, typename arg1_t::c_type value1,
+            out_t* out) {
+    AppendOpResult(out, op_.Op::ExecuteScalar(
+                            ToOpArg<typename Op::ArgType0>(value0),
+                            ToOpArg<typename Op::ArgType1>(value1)));
+  }
+
+  Op op_;
+  std::vector<typename Op::ArgType0> scratch0_;
+  std::vector<typename Op::ArgType1> scratch1_;
+  std::vector<uint8_t> validity_;
+  ScratchArray<typename Op::ReturnT> results_;
+};
+
+}  // namespace
+
+void CellFromTokenKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::FromToken>>(out, "s2_cellfromtoken");
+}
+
+void CellFromDebugStringKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::FromDebugString>>(
+      out, "s2_cellfromdebugstring");
+}
+
+void CellToTokenKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::ToToken>>(out, "s2_celltotoken");
+}
+
+void CellToDebugStringKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::ToDebugString>>(
+      out, "s2_celltodebugstring");
+}
+
+void CellIsValidKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::IsValid>>(out, "s2_cellisvalid");
+}
+
+void CellCenterKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::CellCenter>>(out, "s2_cellcenter");
+}
+
+void CellVertexKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::CellVertex>>(out, "s2_cellvertex");
+}
+
+void CellLevelKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::Level>>(out, "s2_celllevel");
+}
+
+void CellRangeMinKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::RangeMin>>(out, "s2_cellrangemin");
+}
+
+void CellRangeMaxKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::RangeMax>>(out, "s2_cellrangemax");
+}
+
+void CellAreaKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::Area>>(out, "s2_cellarea");
+}
+
+void CellAreaApproxKernel(struct SedonaCScalarKernel* out) {
+  InitUnaryKernel<UnaryOpExec<op::cell::AreaApprox>>(out,
+                                                     "s2_cellareaapprox");
+}
+
+void CellParentKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::Parent>>(out, "s2_cellparent");
+}
+
+void CellChildKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::Child>>(out, "s2_cellchild");
+}
+
+void CellEdgeNeighborKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::EdgeNeighbor>>(
+      out, "s2_celledgeneighbor");
+}
+
+void CellContainsKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::Contains>>(out, "s2_cellcontains");
+}
+
+void CellMayIntersectKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::MayIntersect>>(
+      out, "s2_cellmayintersect");
+}
+
+void CellDistanceKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::Distance>>(out, "s2_celldistance");
+}
+
+void CellMaxDistanceKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::MaxDistance>>(
+      out, "s2_cellmaxdistance");
+}
+
+void CellCommonAncestorLevelKernel(struct SedonaCScalarKernel* out) {
+  InitBinaryKernel<BinaryOpExec<op::cell::CommonAncestorLevel>>(
+      out, "s2_cellcommonancestorlevel");
+}
+
+}  // namespace s2geography::sedona_udf
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "s2geography/sedona_udf/sedona_extension.h"
+
+namespace s2geography {
+
+namespace sedona_udf {
+
+/// \defgroup cell-kernels Cell operator kernels
+///
+/// Each of these kernels executes the op::cell operator of the same name
+/// over Arrow input. Cell identifiers are accepted as any integer type and
+/// returned as int64; points are returned as geography. Sentinel results
+/// for invalid input (kCellIdNone, kCellIdSentinel, a level of -1, or NaN)
+/// are returned as null.
+///
+/// @{
+
+void CellFromTokenKernel(struct SedonaCScalarKernel* out);
+void CellFromDebugStringKernel(struct SedonaCScalarKernel* out);
+void CellToTokenKernel(struct SedonaCScalarKernel* out);
+void CellToDebugStringKernel(struct SedonaCScalarKernel* out);
+void CellIsValidKernel(struct SedonaCScalarKernel* out);
+void CellCenterKernel(struct SedonaCScalarKernel* out);
+void CellVertexKernel(struct SedonaCScalarKernel* out);
+void CellLevelKernel(struct SedonaCScalarKernel* out);
+void CellRangeMinKernel(struct SedonaCScalarKernel* out);
+void CellRangeMaxKernel(struct SedonaCScalarKernel* out);
+void CellAreaKernel(struct SedonaCScalarKernel* out);
+void CellAreaApproxKernel(struct SedonaCScalarKernel* out);
+void CellParentKernel(struct SedonaCScalarKernel* out);
+void CellChildKernel(struct SedonaCScalarKernel* out);
+void CellEdgeNeighborKernel(struct SedonaCScalarKernel* out);
+void CellContainsKernel(struct SedonaCScalarKernel* out);
+void CellMayIntersectKernel(struct SedonaCScalarKernel* out);
+void CellDistanceKernel(struct SedonaCScalarKernel* out);
+void CellMaxDistanceKernel(struct SedonaCScalarKernel* out);
+void CellCommonAncestorLevelKernel(struct SedonaCScalarKernel* out);
+
+/// @}
+
+}  // namespace sedona_udf
+
+}  // namespace s2geography
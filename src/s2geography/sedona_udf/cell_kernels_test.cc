@@ -0,0 +1,273 @@
+
+#include "s2geography/sedona_udf/cell_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "nanoarrow/nanoarrow.hpp"
+#include "s2geography/op/cell.h"
+#include "s2geography/sedona_udf/sedona_udf_internal.h"
+#include "s2geography/sedona_udf/sedona_udf_test_internal.h"
+
+namespace s2geography::sedona_udf {
+
+using op::Execute;
+using op::ExecuteString;
+using op::cell::kCellIdSentinel;
+
+static uint64_t TestCellId() {
+  op::point::Point pt =
+      Execute<op::point::ToPoint>(op::point::LngLat{-64, 45});
+  return Execute<op::cell::FromPoint>(pt);
+}
+
+static nanoarrow::UniqueArray CellIdArray(
+    const std::vector<std::optional<uint64_t>>& values) {
+  nanoarrow::UniqueArray array;
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_UINT64));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+  for (const auto& value : values) {
+    if (value) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendUInt(array.get(), *value));
+    } else {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendNull(array.get(), 1));
+    }
+  }
+
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), nullptr));
+  return array;
+}
+
+TEST(CellKernels, Level) {
+  struct SedonaCScalarKernel kernel;
+  CellLevelKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {NANOARROW_TYPE_UINT64}, NANOARROW_TYPE_INT64));
+
+  auto cell_ids = CellIdArray({TestCellId(), kCellIdSentinel, std::nullopt});
+  struct ArrowArray* args[] = {cell_ids.get()};
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(impl.execute(&impl, args, 1, 3, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+      out_array.get(), NANOARROW_TYPE_INT64, {30, std::nullopt, std::nullopt}));
+}
+
+TEST(CellKernels, Parent) {
+  struct SedonaCScalarKernel kernel;
+  CellParentKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {NANOARROW_TYPE_UINT64, NANOARROW_TYPE_INT32},
+      NANOARROW_TYPE_INT64));
+
+  auto cell_ids = CellIdArray({TestCellId(), kCellIdSentinel});
+  auto level = ArgArrow(NANOARROW_TYPE_INT32, {5});
+  struct ArrowArray* args[] = {cell_ids.get(), level.get()};
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(impl.execute(&impl, args, 2, 2, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  nanoarrow::UniqueArrayView out_view;
+  ArrowArrayViewInitFromType(out_view.get(), NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(out_view.get(), out_array.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(out_view->length, 2);
+  EXPECT_EQ(
+      static_cast<uint64_t>(ArrowArrayViewGetIntUnsafe(out_view.get(), 0)),
+      Execute<op::cell::Parent>(TestCellId(), 5));
+  EXPECT_TRUE(ArrowArrayViewIsNull(out_view.get(), 1));
+}
+
+// Integer input is executed a batch at a time directly over the Arrow
+// buffers unless statistics are collected (or the validity bitmap of an
+// argument doesn't start on a byte boundary), in which case rows are
+// executed one at a time. Both must give the same result.
+TEST(CellKernels, BatchMatchesRows) {
+  uint64_t parent = Execute<op::cell::Parent>(TestCellId(), 5);
+
+  for (bool collect_stats : {false, true}) {
+    for (int64_t offset : {0, 1}) {
+      SCOPED_TRACE("collect_stats: " + std::to_string(collect_stats) +
+                   " offset: " + std::to_string(offset));
+
+      struct SedonaCScalarKernel kernel;
+      CellCommonAncestorLevelKernel(&kernel);
+      KernelSetCollectStats(&kernel, collect_stats);
+      struct SedonaCScalarKernelImpl impl;
+      ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+          &kernel, &impl, {NANOARROW_TYPE_UINT64, NANOARROW_TYPE_UINT64},
+          NANOARROW_TYPE_INT64));
+
+      auto cell_ids = CellIdArray(
+          {parent, TestCellId(), parent, kCellIdSentinel, std::nullopt, 0});
+      auto cell_ids_test =
+          CellIdArray({std::nullopt, parent, TestCellId(), TestCellId(),
+                       TestCellId(), std::nullopt});
+      for (struct ArrowArray* array : {cell_ids.get(), cell_ids_test.get()}) {
+        array->offset += offset;
+        array->length -= offset;
+        array->null_count = -1;
+      }
+
+      struct ArrowArray* args[] = {cell_ids.get(), cell_ids_test.get()};
+      nanoarrow::UniqueArray out_array;
+      ASSERT_EQ(impl.execute(&impl, args, 2, 6 - offset, out_array.get()),
+                NANOARROW_OK)
+          << impl.get_last_error(&impl);
+      impl.release(&impl);
+      kernel.release(&kernel);
+
+      std::vector<std::optional<double>> expected = {
+          std::nullopt, 5, 5, std::nullopt, std::nullopt, std::nullopt};
+      expected.erase(expected.begin(), expected.begin() + offset);
+      ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+          out_array.get(), NANOARROW_TYPE_INT64, expected));
+    }
+  }
+}
+
+TEST(CellKernels, TokenRoundTrip) {
+  struct SedonaCScalarKernel to_token;
+  CellToTokenKernel(&to_token);
+  struct SedonaCScalarKernelImpl to_token_impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(&to_token, &to_token_impl,
+                                         {NANOARROW_TYPE_UINT64},
+                                         NANOARROW_TYPE_STRING));
+
+  auto cell_ids = CellIdArray({TestCellId(), std::nullopt});
+  struct ArrowArray* args[] = {cell_ids.get()};
+  nanoarrow::UniqueArray tokens;
+  ASSERT_EQ(to_token_impl.execute(&to_token_impl, args, 1, 2, tokens.get()),
+            NANOARROW_OK)
+      << to_token_impl.get_last_error(&to_token_impl);
+  to_token_impl.release(&to_token_impl);
+  to_token.release(&to_token);
+
+  nanoarrow::UniqueArrayView tokens_view;
+  ArrowArrayViewInitFromType(tokens_view.get(), NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(tokens_view.get(), tokens.get(), nullptr),
+            NANOARROW_OK);
+  struct ArrowStringView token =
+      ArrowArrayViewGetStringUnsafe(tokens_view.get(), 0);
+  EXPECT_EQ(std::string(token.data, token.size_bytes),
+            ExecuteString<op::cell::ToToken>(TestCellId()));
+  EXPECT_TRUE(ArrowArrayViewIsNull(tokens_view.get(), 1));
+
+  struct SedonaCScalarKernel from_token;
+  CellFromTokenKernel(&from_token);
+  struct SedonaCScalarKernelImpl from_token_impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(&from_token, &from_token_impl,
+                                         {NANOARROW_TYPE_STRING},
+                                         NANOARROW_TYPE_INT64));
+
+  args[0] = tokens.get();
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(
+      from_token_impl.execute(&from_token_impl, args, 1, 2, out_array.get()),
+      NANOARROW_OK)
+      << from_token_impl.get_last_error(&from_token_impl);
+  from_token_impl.release(&from_token_impl);
+  from_token.release(&from_token);
+
+  nanoarrow::UniqueArrayView out_view;
+  ArrowArrayViewInitFromType(out_view.get(), NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(out_view.get(), out_array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(
+      static_cast<uint64_t>(ArrowArrayViewGetIntUnsafe(out_view.get(), 0)),
+      TestCellId());
+  EXPECT_TRUE(ArrowArrayViewIsNull(out_view.get(), 1));
+}
+
+TEST(CellKernels, DebugString) {
+  // Face cells, whose IDs are exactly representable as the doubles used to
+  // check the results
+  uint64_t face0 = uint64_t{1} << 60;
+  uint64_t face1 = uint64_t{3} << 60;
+
+  struct SedonaCScalarKernel to_debug_string;
+  CellToDebugStringKernel(&to_debug_string);
+  struct SedonaCScalarKernelImpl to_impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(&to_debug_string, &to_impl,
+                                         {NANOARROW_TYPE_UINT64},
+                                         NANOARROW_TYPE_STRING));
+
+  auto cell_ids = CellIdArray({face0, std::nullopt, face1, kCellIdSentinel});
+  struct ArrowArray* args[] = {cell_ids.get()};
+  nanoarrow::UniqueArray strings;
+  ASSERT_EQ(to_impl.execute(&to_impl, args, 1, 4, strings.get()),
+            NANOARROW_OK)
+      << to_impl.get_last_error(&to_impl);
+  to_impl.release(&to_impl);
+  to_debug_string.release(&to_debug_string);
+
+  nanoarrow::UniqueArrayView strings_view;
+  ArrowArrayViewInitFromType(strings_view.get(), NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), strings.get(), nullptr),
+            NANOARROW_OK);
+  std::vector<std::optional<std::string>> actual;
+  for (int64_t i = 0; i < strings_view->length; i++) {
+    if (ArrowArrayViewIsNull(strings_view.get(), i)) {
+      actual.push_back(std::nullopt);
+    } else {
+      struct ArrowStringView value =
+          ArrowArrayViewGetStringUnsafe(strings_view.get(), i);
+      actual.push_back(std::string(value.data, value.size_bytes));
+    }
+  }
+
+  EXPECT_EQ(actual, (std::vector<std::optional<std::string>>{
+                        "0/", std::nullopt, "1/",
+                        "Invalid: ffffffffffffffff"}));
+
+  struct SedonaCScalarKernel from_debug_string;
+  CellFromDebugStringKernel(&from_debug_string);
+  struct SedonaCScalarKernelImpl from_impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(&from_debug_string, &from_impl,
+                                         {NANOARROW_TYPE_STRING},
+                                         NANOARROW_TYPE_INT64));
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &from_impl, {NANOARROW_TYPE_STRING}, {}, {},
+      {{"0/", "1/", "7/", "", std::nullopt}}, out_array.get()));
+  from_impl.release(&from_impl);
+  from_debug_string.release(&from_debug_string);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+      out_array.get(), NANOARROW_TYPE_INT64,
+      {static_cast<double>(face0), static_cast<double>(face1), std::nullopt,
+       std::nullopt, std::nullopt}));
+}
+
+TEST(CellKernels, CellCenter) {
+  struct SedonaCScalarKernel kernel;
+  CellCenterKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {NANOARROW_TYPE_UINT64}, ARROW_TYPE_WKB));
+
+  auto cell_ids = CellIdArray({TestCellId(), kCellIdSentinel});
+  struct ArrowArray* args[] = {cell_ids.get()};
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(impl.execute(&impl, args, 1, 2, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  impl.release(&impl);
+  kernel.release(&kernel);
+
+  ASSERT_NO_FATAL_FAILURE(TestResultGeography(
+      out_array.get(), {"POINT (-64 45)", std::nullopt}));
+}
+
+}  // namespace s2geography::sedona_udf
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "geoarrow/geoarrow.hpp"
+#include "s2geography/geoarrow-geography.h"
+
+namespace s2geography {
+
+namespace sedona_udf {
+
+/// \brief Memory-bounded LRU cache of prepared geographies keyed by WKB
+///
+/// Preparing a geography (i.e., building its shape index and covering) is
+/// often much more expensive than the operation it is prepared for. When
+/// the same geographies appear in many batches (e.g., a fixed set of
+/// geofences evaluated against a stream), this cache allows that work to
+/// be done once. Entries own a copy of their WKB bytes such that they
+/// outlive the batch in which they were first seen and are accounted for
+/// using GeoArrowGeography::MemUsed(). Entries inserted without preparing
+/// them are charged for an index built lazily by an operation once the
+/// caller reports it with UpdateMemUsed().
+///
+/// All methods are thread safe such that one cache can be shared among all
+/// the SedonaCScalarKernelImpls created from a SedonaCScalarKernel. Lookups
+/// hand out shared ownership such that eviction never invalidates a
+/// geography that is still in use.
+class GeographyCache {
+ public:
+  class Entry {
+   public:
+    Entry() { GeoArrowGeometryInit(&geom_); }
+    ~Entry() { GeoArrowGeometryReset(&geom_); }
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+    const GeoArrowGeography& geog() const { return geog_; }
+    std::string_view wkb() const { return wkb_; }
+    size_t mem_used() const { return mem_used_.load(); }
+
+   private:
+    friend class GeographyCache;
+    std::string wkb_;
+    struct GeoArrowGeometry geom_;
+    GeoArrowGeography geog_;
+    std::atomic<size_t> mem_used_{};
+    // Whether mem_used_ includes this entry's index
+    std::atomic<bool> index_charged_{false};
+
+    size_t MemUsed() {
+      return sizeof(Entry) + wkb_.capacity() +
+             geom_.capacity_nodes * sizeof(struct GeoArrowGeometryNode) +
+             geog_.MemUsed();
+    }
+  };
+
+  explicit GeographyCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+  GeographyCache(const GeographyCache&) = delete;
+  GeographyCache& operator=(const GeographyCache&) = delete;
+
+  /// \brief Find a previously inserted geography with identical WKB
+  ///
+  /// Returns nullptr if there is no such entry.
+  std::shared_ptr<const Entry> Lookup(std::string_view wkb) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(wkb);
+    if (it == entries_.end()) {
+      ++num_misses_;
+      return nullptr;
+    }
+
+    ++num_hits_;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return *it->second;
+  }
+
+  /// \brief Parse, optionally prepare, and insert a geography
+  ///
+  /// Parsing and preparing happen outside the lock using the caller's
+  /// reader. The returned entry is always valid even if it was too large
+  /// to keep in the cache. If another thread inserted the same value in
+  /// the meantime, its entry is returned instead and is_new (if provided)
+  /// is set to false.
+  std::shared_ptr<const Entry> Insert(std::string_view wkb,
+                                      struct GeoArrowWKBReader* reader,
+                                      bool prepare, bool* is_new = nullptr) {
+    auto entry = std::make_shared<Entry>();
+    entry->wkb_ = std::string(wkb);
+
+    struct GeoArrowBufferView src = {
+        reinterpret_cast<const uint8_t*>(entry->wkb_.data()),
+        static_cast<int64_t>(entry->wkb_.size())};
+    struct GeoArrowGeometryView geom{};
+    GEOARROW_THROW_NOT_OK(nullptr,
+                          GeoArrowWKBReaderRead(reader, src, &geom, nullptr));
+    GEOARROW_THROW_NOT_OK(nullptr,
+                          GeoArrowGeometryShallowCopy(geom, &entry->geom_));
+    entry->geog_.Init(GeoArrowGeometryAsView(&entry->geom_));
+    if (prepare) {
+      entry->geog_.ForceBuildIndex();
+      entry->index_charged_ = true;
+    }
+
+    entry->mem_used_ = entry->MemUsed();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Another thread may have inserted the same value in the meantime
+    auto it = entries_.find(wkb);
+    if (it != entries_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second);
+      if (is_new != nullptr) {
+        *is_new = false;
+      }
+      return *it->second;
+    }
+
+    if (is_new != nullptr) {
+      *is_new = true;
+    }
+
+    if (entry->mem_used_ > max_bytes_) {
+      return entry;
+    }
+
+    lru_.push_front(entry);
+    entries_.emplace(entry->wkb(), lru_.begin());
+    bytes_used_ += entry->mem_used_;
+    EvictToLimit();
+    return entry;
+  }
+
+  /// \brief Charge an entry for an index built after it was inserted
+  ///
+  /// Operations build the index of an entry that was inserted without
+  /// preparing it on first use. Callers should call this when they are done
+  /// using an entry such that the index counts towards the limit (which may
+  /// evict this or other entries). This is cheap if there is nothing to do.
+  void UpdateMemUsed(const Entry& entry) {
+    if (entry.index_charged_.load() || entry.geog().is_unindexed()) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(entry.wkb());
+    if (it == entries_.end() || it->second->get() != &entry ||
+        (*it->second)->index_charged_.load()) {
+      return;
+    }
+
+    Entry& cached = **it->second;
+    size_t mem_used = cached.MemUsed();
+    bytes_used_ = bytes_used_ - cached.mem_used_ + mem_used;
+    cached.mem_used_ = mem_used;
+    cached.index_charged_ = true;
+    EvictToLimit();
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    bytes_used_ = 0;
+  }
+
+  size_t max_bytes() const { return max_bytes_; }
+
+  size_t bytes_used() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_used_;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  int64_t num_hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_hits_;
+  }
+
+  int64_t num_misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_misses_;
+  }
+
+ private:
+  // Most recently used entries are at the front. Keys of entries_ point
+  // into the WKB owned by each entry.
+  using EntryList = std::list<std::shared_ptr<Entry>>;
+
+  mutable std::mutex mutex_;
+  size_t max_bytes_;
+  size_t bytes_used_{};
+  int64_t num_hits_{};
+  int64_t num_misses_{};
+  EntryList lru_;
+  std::unordered_map<std::string_view, EntryList::iterator> entries_;
+
+  // Must be called with mutex_ held
+  void EvictToLimit() {
+    while (bytes_used_ > max_bytes_ && !lru_.empty()) {
+      const std::shared_ptr<Entry>& oldest = lru_.back();
+      bytes_used_ -= oldest->mem_used_;
+      entries_.erase(oldest->wkb());
+      lru_.pop_back();
+    }
+  }
+};
+
+}  // namespace sedona_udf
+
+}  // namespace s2geography
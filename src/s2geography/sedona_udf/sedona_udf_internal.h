@@ -3,13 +3,18 @@
 #include <algorithm>
 #include <array>
 #include <cerrno>
+#include <chrono>
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <unordered_set>
+#include <vector>
 
 #include "geoarrow/geoarrow.hpp"
 #include "nanoarrow/nanoarrow.hpp"
 #include "s2geography.h"
 #include "s2geography/geoarrow-geography.h"
+#include "s2geography/sedona_udf/geography_cache.h"
 #include "s2geography/sedona_udf/sedona_extension.h"
 
 namespace s2geography {
@@ -55,6 +60,146 @@ struct has_exec_init_ternary<T, std::void_t<decltype(std::declval<T>().Init(
                                     std::declval<typename T::out_t*>()))>>
     : std::true_type {};
 
+/// \brief Detection trait for optional Exec::ExecBatch(arg0_t*, int64_t,
+/// out_t*) method
+///
+/// Execs may implement this to compute a whole batch directly from the
+/// buffers of their input views. It returns false without appending any
+/// output if it can't handle the current batch (e.g., for an unsupported
+/// storage type), in which case the adapter executes the batch row by row.
+/// It is not called when statistics are collected such that every row is
+/// recorded.
+template <typename T, typename = void>
+struct has_exec_batch : std::false_type {};
+
+template <typename T>
+struct has_exec_batch<T, std::void_t<decltype(std::declval<T>().ExecBatch(
+                             std::declval<typename T::arg0_t*>(),
+                             std::declval<int64_t>(),
+                             std::declval<typename T::out_t*>()))>>
+    : std::true_type {};
+
+/// \brief Detection trait for optional Exec::ExecBatch(arg0_t*, arg1_t*,
+/// int64_t, out_t*) method
+template <typename T, typename = void>
+struct has_exec_batch_binary : std::false_type {};
+
+template <typename T>
+struct has_exec_batch_binary<
+    T, std::void_t<decltype(std::declval<T>().ExecBatch(
+           std::declval<typename T::arg0_t*>(),
+           std::declval<typename T::arg1_t*>(), std::declval<int64_t>(),
+           std::declval<typename T::out_t*>()))>> : std::true_type {};
+
+/// \brief Detection trait for optional Exec::options_t, which is provided
+/// to each Exec via Exec::SetOptions(const options_t&) when a kernel is
+/// initialized with options
+template <typename T, typename = void>
+struct has_exec_options : std::false_type {};
+
+template <typename T>
+struct has_exec_options<T, std::void_t<typename T::options_t>>
+    : std::true_type {};
+
+/// \brief Strategies used by Execs to compute a result, roughly from
+/// cheapest to most expensive
+enum class ExecStrategy : int {
+  /// The result follows from emptiness or other trivial properties
+  kTrivial = 0,
+  /// A point-specific fast path
+  kPoint = 1,
+  /// Non-intersecting coverings determined the result
+  kCoveringRejection = 2,
+  /// Edges were compared directly without building an index
+  kBruteForce = 3,
+  /// One side's index was queried using the other side's vertices or edges
+  kSemiIndexed = 4,
+  /// An operation on the shape indexes of both sides
+  kShapeIndex = 5,
+  kNumStrategies = 6
+};
+
+/// \brief Opt-in execution statistics for a SedonaCScalarKernelImpl
+struct ExecStats {
+  int64_t num_batches{};
+  int64_t num_rows{};
+  int64_t num_null_rows{};
+  int64_t num_index_builds{};
+  int64_t num_bytes_parsed{};
+  int64_t exec_time_ns{};
+  std::array<int64_t, static_cast<size_t>(ExecStrategy::kNumStrategies)>
+      num_strategy{};
+
+  void Record(ExecStrategy strategy) {
+    ++num_strategy[static_cast<size_t>(strategy)];
+  }
+
+  void Reset() { *this = ExecStats(); }
+};
+
+/// \brief Base for Execs that record the strategy used for each row
+///
+/// Execs that inherit from this get SetStats() called by the adapter when
+/// statistics were requested for the kernel; otherwise Record() is a no-op.
+struct InstrumentedExec {
+  void SetStats(ExecStats* stats) { stats_ = stats; }
+
+  void Record(ExecStrategy strategy) {
+    if (stats_ != nullptr) {
+      stats_->Record(strategy);
+    }
+  }
+
+  ExecStats* stats_{};
+};
+
+/// \brief Detection trait for optional Exec::SetStats(ExecStats*) method
+template <typename T, typename = void>
+struct has_exec_stats : std::false_type {};
+
+template <typename T>
+struct has_exec_stats<T, std::void_t<decltype(std::declval<T>().SetStats(
+                             std::declval<ExecStats*>()))>> : std::true_type {};
+
+/// \brief Accumulate batch-level statistics over the lifetime of this object
+class ExecStatsBatch {
+ public:
+  ExecStatsBatch(ExecStats* stats, int64_t num_rows)
+      : stats_(stats), num_rows_(num_rows) {
+    if (stats_ != nullptr) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~ExecStatsBatch() {
+    if (stats_ != nullptr) {
+      ++stats_->num_batches;
+      stats_->num_rows += num_rows_;
+      stats_->exec_time_ns +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start_)
+              .count();
+    }
+  }
+
+ private:
+  ExecStats* stats_;
+  int64_t num_rows_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// \brief Count arguments whose index has not been built, which is used to
+/// detect index builds triggered by an Exec
+inline int CountUnindexed(const GeoArrowGeography& value) {
+  return value.is_unindexed() ? 1 : 0;
+}
+
+template <typename T>
+int CountUnindexed(const T& value) {
+  S2GEOGRAPHY_UNUSED(value);
+  return 0;
+}
+
 /// \defgroup sedona_udf-utils Arrow UDF Utilities
 ///
 /// To simplify implementations of a large number of functions, we
@@ -98,18 +243,36 @@ inline int64_t ExecuteNumIterations(int64_t n_rows,
   return 1;
 }
 
+/// \brief Compute the multiplier that maps a row to an element of an argument
+///
+/// Scalar (length one) arguments are broadcast to every row by multiplying
+/// the row by zero, which avoids a modulo or branch for every row.
+inline int64_t BroadcastStride(const struct ArrowArray* array,
+                               int64_t num_rows) {
+  if (array->length == 1) {
+    return 0;
+  } else if (array->length < num_rows) {
+    throw Exception("Array input must have length one or the number of rows");
+  } else {
+    return 1;
+  }
+}
+
 /// \brief Generic output builder for Arrow output
 ///
-/// This output builder handles non-nested Arrow output using the
-/// nanoarrow builder. This builder is not the fastest way to build this
-/// output but it is relatively flexible. It may be faster to build
-/// output include building a C++ vector and wrap that vector into
-/// an array at the very end.
+/// This output builder handles non-nested Arrow output by collecting values
+/// in a C++ vector that is wrapped into an array (without a copy) when the
+/// output is finished. A validity buffer is only materialized once a null is
+/// appended such that null-free output does no per-row validity work.
 template <typename c_type_t, enum ArrowType arrow_type_val>
 class ArrowOutputBuilder {
  public:
   using c_type = c_type_t;
 
+  // Booleans are collected as bytes and packed into a bitmap on Finish()
+  using storage_t =
+      std::conditional_t<std::is_same_v<c_type, bool>, uint8_t, c_type>;
+
   ArrowOutputBuilder() = default;
   ArrowOutputBuilder(const ArrowOutputBuilder&) = delete;
   ArrowOutputBuilder& operator=(const ArrowOutputBuilder&) = delete;
@@ -124,48 +287,245 @@ class ArrowOutputBuilder {
   }
 
   void Reserve(int64_t additional_size) {
-    array_.reset();
-    NANOARROW_THROW_NOT_OK(
-        ArrowArrayInitFromType(array_.get(), arrow_type_val));
-    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array_.get()));
-
-    NANOARROW_THROW_NOT_OK(ArrowArrayReserve(array_.get(), additional_size));
+    values_.clear();
+    values_.reserve(additional_size);
+    nulls_.clear();
+    null_count_ = 0;
   }
 
   void AppendNull() {
-    NANOARROW_THROW_NOT_OK(ArrowArrayAppendNull(array_.get(), 1));
-  }
+    if (nulls_.empty()) {
+      nulls_.reserve(values_.capacity());
+      nulls_.resize(values_.size(), 1);
+    }
 
-  void AppendEmpty() {
-    NANOARROW_THROW_NOT_OK(ArrowArrayAppendEmpty(array_.get(), 1));
+    nulls_.push_back(0);
+    values_.push_back(storage_t{});
+    ++null_count_;
   }
 
+  void AppendEmpty() { Append(c_type{}); }
+
   void Append(c_type value) {
-    if constexpr (std::is_integral_v<c_type>) {
-      NANOARROW_THROW_NOT_OK(ArrowArrayAppendInt(array_.get(), value));
-    } else if constexpr (std::is_floating_point_v<c_type>) {
-      NANOARROW_THROW_NOT_OK(ArrowArrayAppendDouble(array_.get(), value));
-    } else {
-      static_assert(always_false<c_type>::value, "value type not supported");
+    if (!nulls_.empty()) {
+      nulls_.push_back(1);
     }
+
+    values_.push_back(static_cast<storage_t>(value));
   }
 
-  int64_t current_length() { return array_->length; }
+  /// \brief Append n non-null values to be written directly by the caller
+  ///
+  /// Returns a pointer to the first appended value, which remains valid
+  /// until the next call that appends to this builder.
+  storage_t* AppendUninitialized(int64_t n) {
+    size_t offset = values_.size();
+    values_.resize(offset + n);
+    if (!nulls_.empty()) {
+      nulls_.resize(offset + n, 1);
+    }
+
+    return values_.data() + offset;
+  }
+
+  /// \brief Mark the previously appended value at position i as null
+  void SetNull(int64_t i) {
+    if (nulls_.empty()) {
+      nulls_.reserve(values_.capacity());
+      nulls_.resize(values_.size(), 1);
+    }
+
+    null_count_ += nulls_[i];
+    nulls_[i] = 0;
+  }
+
+  int64_t current_length() { return static_cast<int64_t>(values_.size()); }
 
   void Finish(struct ArrowArray* out) {
-    NANOARROW_THROW_NOT_OK(
-        ArrowArrayFinishBuildingDefault(array_.get(), nullptr));
-    ArrowArrayMove(array_.get(), out);
+    int64_t length = current_length();
+    nanoarrow::UniqueArray tmp;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(tmp.get(), arrow_type_val));
+
+    if (null_count_ > 0) {
+      nanoarrow::UniqueBitmap nulls;
+      ArrowBitmapInit(nulls.get());
+      NANOARROW_THROW_NOT_OK(ArrowBitmapReserve(nulls.get(), length));
+      ArrowBitmapAppendInt8Unsafe(nulls.get(), nulls_.data(), length);
+      ArrowArraySetValidityBitmap(tmp.get(), nulls.get());
+    }
+
+    if constexpr (std::is_same_v<c_type, bool>) {
+      nanoarrow::UniqueBitmap values;
+      ArrowBitmapInit(values.get());
+      NANOARROW_THROW_NOT_OK(ArrowBitmapReserve(values.get(), length));
+      ArrowBitmapAppendInt8Unsafe(
+          values.get(), reinterpret_cast<const int8_t*>(values_.data()),
+          length);
+      NANOARROW_THROW_NOT_OK(
+          ArrowArraySetBuffer(tmp.get(), 1, &values->buffer));
+    } else {
+      nanoarrow::UniqueBuffer values;
+      nanoarrow::BufferInitSequence(values.get(), std::move(values_));
+      NANOARROW_THROW_NOT_OK(ArrowArraySetBuffer(tmp.get(), 1, values.get()));
+    }
+
+    tmp->length = length;
+    tmp->null_count = null_count_;
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(tmp.get(), nullptr));
+    ArrowArrayMove(tmp.get(), out);
+
+    values_.clear();
+    nulls_.clear();
+    null_count_ = 0;
   }
 
- protected:
-  nanoarrow::UniqueArray array_;
+ private:
+  std::vector<storage_t> values_;
+  std::vector<int8_t> nulls_;
+  int64_t null_count_{};
 };
 
 using BoolOutputBuilder = ArrowOutputBuilder<bool, NANOARROW_TYPE_BOOL>;
 using IntOutputBuilder = ArrowOutputBuilder<int64_t, NANOARROW_TYPE_INT64>;
 using DoubleOutputBuilder = ArrowOutputBuilder<double, NANOARROW_TYPE_DOUBLE>;
 
+/// \brief Output builder for Arrow string output
+///
+/// Like the ArrowOutputBuilder, offsets and bytes are collected in C++
+/// vectors and moved into the output array when it is finished.
+class StringOutputBuilder {
+ public:
+  using c_type = std::string_view;
+
+  StringOutputBuilder() { offsets_.push_back(0); }
+  StringOutputBuilder(const StringOutputBuilder&) = delete;
+  StringOutputBuilder& operator=(const StringOutputBuilder&) = delete;
+
+  void InitOutputType(struct ArrowSchema* out) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(out, NANOARROW_TYPE_STRING));
+  }
+
+  void InitOutputTypeWithCrs(struct ArrowSchema* out, const std::string& crs) {
+    S2GEOGRAPHY_UNUSED(crs);
+    InitOutputType(out);
+  }
+
+  void Reserve(int64_t additional_size) {
+    offsets_.clear();
+    offsets_.reserve(additional_size + 1);
+    offsets_.push_back(0);
+    data_.clear();
+    nulls_.clear();
+    null_count_ = 0;
+  }
+
+  void AppendNull() {
+    if (nulls_.empty()) {
+      nulls_.reserve(offsets_.capacity());
+      nulls_.resize(current_length(), 1);
+    }
+
+    nulls_.push_back(0);
+    offsets_.push_back(offsets_.back());
+    ++null_count_;
+  }
+
+  void AppendEmpty() { Append(std::string_view()); }
+
+  void Append(std::string_view value) {
+    if (!nulls_.empty()) {
+      nulls_.push_back(1);
+    }
+
+    data_.insert(data_.end(), value.begin(), value.end());
+    if (data_.size() > static_cast<size_t>(INT32_MAX)) {
+      throw Exception("String output exceeds 2GB");
+    }
+
+    offsets_.push_back(static_cast<int32_t>(data_.size()));
+  }
+
+  /// \brief Append n non-null values encoded directly by the caller
+  ///
+  /// encode(data, offsets) is called with space for max_size bytes of data
+  /// and n + 1 offsets, which it must write relative to data (i.e., starting
+  /// with zero).
+  template <typename Encode>
+  void AppendEncoded(int64_t n, int64_t max_size, Encode&& encode) {
+    size_t data_start = data_.size();
+    if (data_start + max_size > static_cast<size_t>(INT32_MAX)) {
+      throw Exception("String output exceeds 2GB");
+    }
+
+    size_t offsets_start = offsets_.size() - 1;
+    data_.resize(data_start + max_size);
+    offsets_.resize(offsets_start + n + 1);
+    if (!nulls_.empty()) {
+      nulls_.resize(offsets_start + n, 1);
+    }
+
+    int32_t* offsets = offsets_.data() + offsets_start;
+    encode(data_.data() + data_start, offsets);
+    for (int64_t i = 0; i <= n; i++) {
+      offsets[i] += static_cast<int32_t>(data_start);
+    }
+
+    data_.resize(offsets_.back());
+  }
+
+  /// \brief Mark the previously appended value at position i as null
+  void SetNull(int64_t i) {
+    if (nulls_.empty()) {
+      nulls_.reserve(offsets_.capacity());
+      nulls_.resize(current_length(), 1);
+    }
+
+    null_count_ += nulls_[i];
+    nulls_[i] = 0;
+  }
+
+  int64_t current_length() { return static_cast<int64_t>(offsets_.size()) - 1; }
+
+  void Finish(struct ArrowArray* out) {
+    int64_t length = current_length();
+    nanoarrow::UniqueArray tmp;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayInitFromType(tmp.get(), NANOARROW_TYPE_STRING));
+
+    if (null_count_ > 0) {
+      nanoarrow::UniqueBitmap nulls;
+      ArrowBitmapInit(nulls.get());
+      NANOARROW_THROW_NOT_OK(ArrowBitmapReserve(nulls.get(), length));
+      ArrowBitmapAppendInt8Unsafe(nulls.get(), nulls_.data(), length);
+      ArrowArraySetValidityBitmap(tmp.get(), nulls.get());
+    }
+
+    nanoarrow::UniqueBuffer offsets;
+    nanoarrow::BufferInitSequence(offsets.get(), std::move(offsets_));
+    NANOARROW_THROW_NOT_OK(ArrowArraySetBuffer(tmp.get(), 1, offsets.get()));
+
+    nanoarrow::UniqueBuffer data;
+    nanoarrow::BufferInitSequence(data.get(), std::move(data_));
+    NANOARROW_THROW_NOT_OK(ArrowArraySetBuffer(tmp.get(), 2, data.get()));
+
+    tmp->length = length;
+    tmp->null_count = null_count_;
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(tmp.get(), nullptr));
+    ArrowArrayMove(tmp.get(), out);
+
+    offsets_.assign(1, 0);
+    data_.clear();
+    nulls_.clear();
+    null_count_ = 0;
+  }
+
+ private:
+  std::vector<int32_t> offsets_;
+  std::vector<char> data_;
+  std::vector<int8_t> nulls_;
+  int64_t null_count_{};
+};
+
 template <typename Child>
 class ListOutputBuilder {
  public:
@@ -481,9 +841,13 @@ class GeoArrowOutputBuilder {
     }
   }
 
+  /// \brief The output dimensions set by SetDimensions()
+  uint8_t dimensions() const { return dim_; }
+
   /// \brief Append a null value
   void AppendNull() {
     GEOARROW_THROW_NOT_OK(nullptr, GeoArrowWKBWriterAppendNull(&writer_));
+    ++length_;
   }
 
   /// \brief Append an empty geometry of a specified type
@@ -521,10 +885,14 @@ class GeoArrowOutputBuilder {
   /// feature
   void AppendGeometry(struct GeoArrowGeometryView geom) {
     GEOARROW_THROW_NOT_OK(nullptr, GeoArrowWKBWriterAppend(&writer_, geom));
+    ++length_;
   }
 
   /// \brief Start a feature (must be paired with FeatureEnd())
-  void FeatureStart() { GEOARROW_THROW_NOT_OK(&error_, v_.feat_start(&v_)); }
+  void FeatureStart() {
+    GEOARROW_THROW_NOT_OK(&error_, v_.feat_start(&v_));
+    ++length_;
+  }
 
   /// \brief Start a geometry (must be paired with GeomEnd())
   void GeomStart(enum GeoArrowGeometryType geometry_type) {
@@ -596,10 +964,15 @@ class GeoArrowOutputBuilder {
   void Finish(struct ArrowArray* out) {
     GEOARROW_THROW_NOT_OK(&error_,
                           GeoArrowWKBWriterFinish(&writer_, out, &error_));
+    length_ = 0;
   }
 
+  /// \brief The number of features appended since the last Finish()
+  int64_t current_length() { return length_; }
+
  private:
   GeoArrowWKBWriter writer_{};
+  int64_t length_{};
   GeoArrowVisitor v_{};
   GeoArrowError error_{};
   enum GeoArrowDimensions dim_ { GEOARROW_DIMENSIONS_XY };
@@ -715,10 +1088,7 @@ class ArrowInputView {
     }
   }
 
-  static std::string GetCrs(const struct ArrowSchema* type) {
-    S2GEOGRAPHY_UNUSED(type);
-    return "";
-  }
+  std::string GetCrs() { return ""; }
 
   ArrowInputView(const struct ArrowSchema* type) {
     NANOARROW_THROW_NOT_OK(
@@ -731,29 +1101,38 @@ class ArrowInputView {
     S2GEOGRAPHY_UNUSED(prepare_scalar);
   }
 
+  void SetCache(std::shared_ptr<GeographyCache> cache) {
+    S2GEOGRAPHY_UNUSED(cache);
+  }
+
+  void SetStats(ExecStats* stats) { S2GEOGRAPHY_UNUSED(stats); }
+
   void SetArray(const struct ArrowArray* array, int64_t num_rows) {
-    S2GEOGRAPHY_UNUSED(num_rows);
     NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(view_.get(), array, nullptr));
-
-    if (array->length == 0) {
-      throw Exception("Array input must not be empty");
-    }
+    stride_ = BroadcastStride(array, num_rows);
   }
 
+  /// \brief Whether IsNull() may return true for any row of this array
+  bool MayHaveNulls() const { return view_->null_count != 0; }
+
+  /// \brief The view of the current array for Execs that read its buffers
+  /// directly (e.g., in ExecBatch())
+  const struct ArrowArrayView* view() const { return view_.get(); }
+
   bool IsNull(int64_t i) {
-    return ArrowArrayViewIsNull(view_.get(), i % view_->length);
+    return ArrowArrayViewIsNull(view_.get(), i * stride_);
   }
 
   c_type_t Get(int64_t i) {
     if constexpr (std::is_same_v<c_type_t, bool>) {
-      return ArrowArrayViewGetIntUnsafe(view_.get(), i % view_->length);
+      return ArrowArrayViewGetIntUnsafe(view_.get(), i * stride_);
     } else if constexpr (std::is_same_v<c_type_t, int64_t>) {
-      return ArrowArrayViewGetIntUnsafe(view_.get(), i % view_->length);
+      return ArrowArrayViewGetIntUnsafe(view_.get(), i * stride_);
     } else if constexpr (std::is_same_v<c_type, double>) {
-      return ArrowArrayViewGetDoubleUnsafe(view_.get(), i % view_->length);
+      return ArrowArrayViewGetDoubleUnsafe(view_.get(), i * stride_);
     } else if constexpr (std::is_same_v<c_type_t, std::string_view>) {
       struct ArrowBufferView val =
-          ArrowArrayViewGetBytesUnsafe(view_.get(), i % view_->length);
+          ArrowArrayViewGetBytesUnsafe(view_.get(), i * stride_);
       return std::string_view(val.data.as_char,
                               static_cast<size_t>(val.size_bytes));
     } else {
@@ -763,6 +1142,7 @@ class ArrowInputView {
 
  private:
   nanoarrow::UniqueArrayView view_;
+  int64_t stride_{1};
 };
 
 using BoolInputView = ArrowInputView<bool>;
@@ -770,17 +1150,213 @@ using IntInputView = ArrowInputView<int64_t>;
 using DoubleInputView = ArrowInputView<double>;
 using StringInputView = ArrowInputView<std::string_view>;
 
+/// \brief View of a single element of a list array
+///
+/// Values are read from the child of the list array such that no copy is
+/// made of the list items.
+template <typename c_type_t>
+class ListElementView {
+ public:
+  ListElementView(const struct ArrowArrayView* items, int64_t offset,
+                  int64_t size)
+      : items_(items), offset_(offset), size_(size) {}
+
+  int64_t size() const { return size_; }
+
+  bool IsNull(int64_t i) const {
+    return ArrowArrayViewIsNull(items_, offset_ + i);
+  }
+
+  c_type_t operator[](int64_t i) const {
+    if constexpr (std::is_same_v<c_type_t, int64_t>) {
+      return ArrowArrayViewGetIntUnsafe(items_, offset_ + i);
+    } else if constexpr (std::is_same_v<c_type_t, double>) {
+      return ArrowArrayViewGetDoubleUnsafe(items_, offset_ + i);
+    } else {
+      static_assert(always_false<c_type_t>::value, "value type not supported");
+    }
+  }
+
+ private:
+  const struct ArrowArrayView* items_;
+  int64_t offset_;
+  int64_t size_;
+};
+
+/// \brief View of list or large list input whose items are accepted by
+/// ArrowInputView<c_type_t>
+template <typename c_type_t>
+class ListInputView {
+ public:
+  using c_type = ListElementView<c_type_t>;
+
+  static bool Matches(const struct ArrowSchema* type) {
+    struct ArrowSchemaView schema_view;
+    NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&schema_view, type, nullptr));
+
+    if (schema_view.extension_name.data != nullptr) {
+      return false;
+    }
+
+    switch (schema_view.type) {
+      case NANOARROW_TYPE_LIST:
+      case NANOARROW_TYPE_LARGE_LIST:
+        return ArrowInputView<c_type_t>::Matches(type->children[0]);
+      default:
+        return false;
+    }
+  }
+
+  std::string GetCrs() { return ""; }
+
+  ListInputView(const struct ArrowSchema* type) {
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewInitFromSchema(view_.get(), type, nullptr));
+  }
+  ListInputView(const ListInputView&) = delete;
+  ListInputView& operator=(const ListInputView&) = delete;
+
+  void SetPrepareScalar(bool prepare_scalar) {
+    S2GEOGRAPHY_UNUSED(prepare_scalar);
+  }
+
+  void SetCache(std::shared_ptr<GeographyCache> cache) {
+    S2GEOGRAPHY_UNUSED(cache);
+  }
+
+  void SetStats(ExecStats* stats) { S2GEOGRAPHY_UNUSED(stats); }
+
+  void SetArray(const struct ArrowArray* array, int64_t num_rows) {
+    NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(view_.get(), array, nullptr));
+    stride_ = BroadcastStride(array, num_rows);
+  }
+
+  bool MayHaveNulls() const { return view_->null_count != 0; }
+
+  bool IsNull(int64_t i) {
+    return ArrowArrayViewIsNull(view_.get(), i * stride_);
+  }
+
+  c_type Get(int64_t i) {
+    // Unlike other accessors, list offsets are not adjusted for the
+    // array's offset
+    int64_t row = view_->offset + i * stride_;
+    int64_t start = ArrowArrayViewListChildOffset(view_.get(), row);
+    int64_t end = ArrowArrayViewListChildOffset(view_.get(), row + 1);
+    return c_type(view_->children[0], start, end - start);
+  }
+
+ private:
+  nanoarrow::UniqueArrayView view_;
+  int64_t stride_{1};
+};
+
+using IntListInputView = ListInputView<int64_t>;
+using DoubleListInputView = ListInputView<double>;
+
+/// \brief View of native geoarrow.point input
+///
+/// Rows are read directly from the coordinate buffers of a separated
+/// (struct) or interleaved (fixed-size list) point array without parsing
+/// or wrapping them in a GeoArrowGeography. Only longitude and latitude are
+/// read; empty points are represented by NaN coordinates.
+class GeoArrowPointInputView {
+ public:
+  using c_type = internal::GeoArrowVertex;
+
+  static bool Matches(const struct ArrowSchema* type) {
+    struct GeoArrowSchemaView schema_view;
+    int err_code = GeoArrowSchemaViewInit(&schema_view, type, nullptr);
+    if (err_code != GEOARROW_OK) {
+      return false;
+    }
+
+    return schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_POINT &&
+           (schema_view.coord_type == GEOARROW_COORD_TYPE_SEPARATE ||
+            schema_view.coord_type == GEOARROW_COORD_TYPE_INTERLEAVED);
+  }
+
+  GeoArrowPointInputView(const struct ArrowSchema* type)
+      : type_(::geoarrow::GeometryDataType::Make(type)) {
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewInitFromSchema(view_.get(), type, nullptr));
+  }
+  GeoArrowPointInputView(const GeoArrowPointInputView&) = delete;
+  GeoArrowPointInputView& operator=(const GeoArrowPointInputView&) = delete;
+
+  std::string GetCrs() { return type_.crs(); }
+
+  void SetPrepareScalar(bool prepare_scalar) {
+    S2GEOGRAPHY_UNUSED(prepare_scalar);
+  }
+
+  void SetCache(std::shared_ptr<GeographyCache> cache) {
+    S2GEOGRAPHY_UNUSED(cache);
+  }
+
+  void SetStats(ExecStats* stats) { S2GEOGRAPHY_UNUSED(stats); }
+
+  void SetArray(const struct ArrowArray* array, int64_t num_rows) {
+    NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(view_.get(), array, nullptr));
+    stride_ = BroadcastStride(array, num_rows);
+
+    if (type_.coord_type() == GEOARROW_COORD_TYPE_SEPARATE) {
+      lngs_ = view_->children[0];
+      lats_ = view_->children[1];
+      coord_stride_ = 1;
+      lat_offset_ = 0;
+    } else {
+      lngs_ = view_->children[0];
+      lats_ = view_->children[0];
+      coord_stride_ = view_->layout.child_size_elements;
+      lat_offset_ = 1;
+    }
+  }
+
+  bool MayHaveNulls() const { return view_->null_count != 0; }
+
+  bool IsNull(int64_t i) {
+    return ArrowArrayViewIsNull(view_.get(), i * stride_);
+  }
+
+  c_type Get(int64_t i) {
+    // Children of struct and fixed-size list arrays are not adjusted for
+    // the parent's offset
+    int64_t row = view_->offset + i * stride_;
+    c_type out;
+    out.lng = ArrowArrayViewGetDoubleUnsafe(lngs_, row * coord_stride_);
+    out.lat = ArrowArrayViewGetDoubleUnsafe(
+        lats_, row * coord_stride_ + lat_offset_);
+    return out;
+  }
+
+ private:
+  ::geoarrow::GeometryDataType type_;
+  nanoarrow::UniqueArrayView view_;
+  const struct ArrowArrayView* lngs_{};
+  const struct ArrowArrayView* lats_{};
+  int64_t stride_{1};
+  int64_t coord_stride_{1};
+  int64_t lat_offset_{};
+};
+
 /// \brief View of GeoArrow input
 ///
 /// This currently handles geoarrow.wkb arrays, although in theory can
-/// represent any GeoArrow type when supported by geoarrow-c.
+/// represent any GeoArrow type when supported by geoarrow-c. Dictionary-encoded
+/// and run-end-encoded arrays whose values are geoarrow.wkb are also
+/// supported: each distinct value is parsed once per batch and, if it is
+/// used more than once and preparing scalars was requested, indexed once
+/// such that repeated values are a lookup rather than a re-parse and
+/// re-index.
 class GeoArrowGeographyInputView {
  public:
   using c_type = const GeoArrowGeography&;
 
   static bool Matches(const struct ArrowSchema* type) {
     struct GeoArrowSchemaView schema_view;
-    int err_code = GeoArrowSchemaViewInit(&schema_view, type, nullptr);
+    int err_code =
+        GeoArrowSchemaViewInit(&schema_view, ValuesType(type), nullptr);
     if (err_code != GEOARROW_OK) {
       return false;
     }
@@ -803,15 +1379,25 @@ class GeoArrowGeographyInputView {
   }
 
   GeoArrowGeographyInputView(const struct ArrowSchema* type)
-      : inner_(type), current_array_length_(1), stashed_index_(-1) {
-    type_ = ::geoarrow::GeometryDataType::Make(type);
+      : encoding_(GetEncoding(type)),
+        inner_(ValuesType(type)),
+        current_array_length_(1),
+        stashed_index_(-1) {
+    type_ = ::geoarrow::GeometryDataType::Make(ValuesType(type));
     GEOARROW_THROW_NOT_OK(nullptr, GeoArrowWKBReaderInit(&reader_));
+    if (encoding_ != Encoding::kPlain) {
+      NANOARROW_THROW_NOT_OK(
+          ArrowArrayViewInitFromSchema(encoded_.get(), type, nullptr));
+    }
   }
   GeoArrowGeographyInputView(const GeoArrowGeographyInputView&) = delete;
   GeoArrowGeographyInputView& operator=(const GeoArrowGeographyInputView&) =
       delete;
 
-  ~GeoArrowGeographyInputView() { GeoArrowWKBReaderReset(&reader_); }
+  ~GeoArrowGeographyInputView() {
+    ReleaseCached();
+    GeoArrowWKBReaderReset(&reader_);
+  }
 
   std::string GetCrs() { return type_.crs(); }
 
@@ -819,32 +1405,307 @@ class GeoArrowGeographyInputView {
     prepare_scalar_ = prepare_scalar;
   }
 
+  /// \brief Use a cache of prepared geographies that persists across batches
+  ///
+  /// Only non-encoded input is looked up in the cache. To avoid paying for
+  /// preparing one-off values, array values are only inserted the second
+  /// time they are seen (scalars are always inserted).
+  void SetCache(std::shared_ptr<GeographyCache> cache) {
+    cache_ = std::move(cache);
+  }
+
+  /// \brief Count bytes parsed and indexes built when preparing values
+  void SetStats(ExecStats* stats) { stats_ = stats; }
+
   void SetArray(const struct ArrowArray* array, int64_t num_rows) {
-    inner_.SetArray(array, num_rows);
+    switch (encoding_) {
+      case Encoding::kPlain:
+        inner_.SetArray(array, num_rows);
+        break;
+      case Encoding::kDictionary:
+        SetEncodedArray(array, array->dictionary, num_rows);
+        break;
+      case Encoding::kRunEnd:
+        SetEncodedArray(array, array->children[1], num_rows);
+        break;
+    }
+
     current_array_length_ = array->length;
+    stride_ = BroadcastStride(array, num_rows);
     stashed_index_ = -1;
+    cached_index_ = -1;
+    ReleaseCached();
+    ++num_arrays_;
   }
 
-  bool IsNull(int64_t i) { return inner_.IsNull(i); }
+  /// \brief Whether the current array is a scalar (i.e., every row is the
+  /// same value)
+  bool is_scalar() const { return current_array_length_ == 1; }
 
-  GeoArrowGeography& Get(int64_t i) {
-    if (current_array_length_ == 1) {
-      StashIfNeeded(0, prepare_scalar_);
-    } else {
-      StashIfNeeded(i);
+  /// \brief The number of arrays set so far
+  ///
+  /// Execs can use this to reuse state derived from a scalar value for every
+  /// row of a batch without comparing values.
+  int64_t num_arrays() const { return num_arrays_; }
+
+  /// \brief Whether IsNull() may return true for any row of this array
+  bool MayHaveNulls() const {
+    switch (encoding_) {
+      case Encoding::kDictionary:
+        return encoded_->null_count != 0 || inner_.MayHaveNulls();
+      default:
+        return inner_.MayHaveNulls();
     }
+  }
 
+  bool IsNull(int64_t i) {
+    switch (encoding_) {
+      case Encoding::kPlain:
+        return inner_.IsNull(i);
+      case Encoding::kDictionary:
+        return ArrowArrayViewIsNull(encoded_.get(), i * stride_) ||
+               inner_.IsNull(ValueIndex(i));
+      case Encoding::kRunEnd:
+      default:
+        return inner_.IsNull(ValueIndex(i));
+    }
+  }
+
+  const GeoArrowGeography& Get(int64_t i) {
+    if (encoding_ != Encoding::kPlain) {
+      return GetDecoded(ValueIndex(i));
+    }
+
+    bool is_scalar = current_array_length_ == 1;
+    int64_t row = i * stride_;
+    if (cache_ && GetCached(row, is_scalar)) {
+      return cached_->geog();
+    }
+
+    StashIfNeeded(row, is_scalar && prepare_scalar_);
     return stashed_;
   }
 
  private:
+  enum class Encoding { kPlain, kDictionary, kRunEnd };
+
+  /// \brief A parsed geography that owns its geometry nodes (coordinates
+  /// still point into the input array)
+  struct DecodedGeography {
+    DecodedGeography() { GeoArrowGeometryInit(&geom); }
+    ~DecodedGeography() { GeoArrowGeometryReset(&geom); }
+    DecodedGeography(const DecodedGeography&) = delete;
+    DecodedGeography& operator=(const DecodedGeography&) = delete;
+
+    struct GeoArrowGeometry geom;
+    GeoArrowGeography geog;
+  };
+
+  // Per-batch state of a dictionary or run-end-encoded value
+  enum ValueState : uint8_t { kUnparsed, kParsed, kPrepared };
+
+  Encoding encoding_;
   ::geoarrow::GeometryDataType type_;
   struct GeoArrowWKBReader reader_;
   ArrowInputView<std::string_view> inner_;
   int64_t current_array_length_;
+  int64_t stride_{1};
+  int64_t num_arrays_{};
   int64_t stashed_index_;
   GeoArrowGeography stashed_;
   bool prepare_scalar_{};
+  ExecStats* stats_{};
+
+  // Only used for dictionary or run-end-encoded input
+  nanoarrow::UniqueArrayView encoded_;
+  int64_t values_length_{};
+  int64_t current_run_{};
+  std::vector<std::unique_ptr<DecodedGeography>> values_;
+  std::vector<uint8_t> values_state_;
+
+  // Only used when a cache was provided
+  static constexpr size_t kMaxSeenHashes = 4096;
+  std::shared_ptr<GeographyCache> cache_;
+  std::shared_ptr<const GeographyCache::Entry> cached_;
+  int64_t cached_index_{-1};
+  std::unordered_set<size_t> seen_hashes_;
+
+  static Encoding GetEncoding(const struct ArrowSchema* type) {
+    if (type->dictionary != nullptr) {
+      return Encoding::kDictionary;
+    } else if (std::strncmp(type->format, "+r", 2) == 0 &&
+               type->n_children == 2) {
+      return Encoding::kRunEnd;
+    } else {
+      return Encoding::kPlain;
+    }
+  }
+
+  static const struct ArrowSchema* ValuesType(const struct ArrowSchema* type) {
+    switch (GetEncoding(type)) {
+      case Encoding::kDictionary:
+        return type->dictionary;
+      case Encoding::kRunEnd:
+        return type->children[1];
+      case Encoding::kPlain:
+      default:
+        return type;
+    }
+  }
+
+  void SetEncodedArray(const struct ArrowArray* array,
+                       const struct ArrowArray* values, int64_t num_rows) {
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewSetArray(encoded_.get(), array, nullptr));
+    current_run_ = 0;
+
+    // An empty batch has no rows to decode and may have an empty run-ends
+    // child, so drop any state left over from the previous batch
+    if (array->length == 0) {
+      values_length_ = 0;
+      values_state_.clear();
+      return;
+    }
+
+    // A dictionary may be empty if all indices are null
+    values_length_ = values->length;
+    if (values_length_ > 0) {
+      inner_.SetArray(values, values_length_);
+    }
+
+    if (static_cast<int64_t>(values_.size()) < values_length_) {
+      values_.resize(values_length_);
+    }
+    values_state_.assign(values_length_, kUnparsed);
+  }
+
+  int64_t ValueIndex(int64_t i) {
+    i = i * stride_;
+    if (encoding_ == Encoding::kDictionary) {
+      return ArrowArrayViewGetIntUnsafe(encoded_.get(), i);
+    }
+
+    // Run ends are relative to the start of the parent (i.e., include its
+    // offset). Rows are almost always requested in order, so check the
+    // current and next run before falling back to a binary search.
+    const struct ArrowArrayView* run_ends = encoded_->children[0];
+    int64_t logical_i = encoded_->offset + i;
+    int64_t run_end = std::min(current_run_ + 2, run_ends->length);
+    for (int64_t run = current_run_; run < run_end; run++) {
+      int64_t run_start =
+          run == 0 ? 0 : ArrowArrayViewGetIntUnsafe(run_ends, run - 1);
+      if (logical_i >= run_start &&
+          logical_i < ArrowArrayViewGetIntUnsafe(run_ends, run)) {
+        current_run_ = run;
+        return run;
+      }
+    }
+
+    int64_t lo = 0;
+    int64_t hi = run_ends->length - 1;
+    while (lo < hi) {
+      int64_t mid = lo + (hi - lo) / 2;
+      if (ArrowArrayViewGetIntUnsafe(run_ends, mid) <= logical_i) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    current_run_ = lo;
+    return lo;
+  }
+
+  GeoArrowGeography& GetDecoded(int64_t value_i) {
+    std::unique_ptr<DecodedGeography>& value = values_[value_i];
+    if (!value) {
+      value = std::make_unique<DecodedGeography>();
+    }
+
+    switch (values_state_[value_i]) {
+      case kUnparsed: {
+        std::string_view inner = inner_.Get(value_i);
+        struct GeoArrowBufferView src = {
+            reinterpret_cast<const uint8_t*>(inner.data()),
+            static_cast<int64_t>(inner.size())};
+
+        struct GeoArrowGeometryView geom{};
+        GEOARROW_THROW_NOT_OK(
+            nullptr, GeoArrowWKBReaderRead(&reader_, src, &geom, nullptr));
+        GEOARROW_THROW_NOT_OK(nullptr,
+                              GeoArrowGeometryShallowCopy(geom, &value->geom));
+        value->geog.Init(GeoArrowGeometryAsView(&value->geom));
+        values_state_[value_i] = kParsed;
+        CountParsed(inner.size());
+
+        // A scalar is always reused
+        if (prepare_scalar_ && current_array_length_ == 1) {
+          Prepare(value->geog);
+          values_state_[value_i] = kPrepared;
+        }
+        break;
+      }
+      case kParsed:
+        // Only pay for an index when a value is used more than once
+        if (prepare_scalar_) {
+          Prepare(value->geog);
+          values_state_[value_i] = kPrepared;
+        }
+        break;
+      default:
+        break;
+    }
+
+    return value->geog;
+  }
+
+  bool GetCached(int64_t row, bool is_scalar) {
+    if (row == cached_index_) {
+      return cached_ != nullptr;
+    }
+
+    cached_index_ = row;
+    ReleaseCached();
+    std::string_view wkb = inner_.Get(row);
+    cached_ = cache_->Lookup(wkb);
+    if (!cached_ && (is_scalar || SeenBefore(wkb))) {
+      // Only count the index of the entry that is used (i.e., not one that
+      // lost a race with another thread inserting the same value)
+      bool is_new = false;
+      cached_ = cache_->Insert(wkb, &reader_, prepare_scalar_, &is_new);
+      CountParsed(wkb.size());
+      if (stats_ != nullptr && prepare_scalar_ && is_new) {
+        ++stats_->num_index_builds;
+      }
+    }
+
+    return cached_ != nullptr;
+  }
+
+  // The operation may have built the index of an entry that was inserted
+  // without preparing it, which the cache can only account for afterwards
+  void ReleaseCached() {
+    if (cached_) {
+      cache_->UpdateMemUsed(*cached_);
+      cached_.reset();
+    }
+  }
+
+  // A tiny admission filter: remember hashes of values that missed the cache
+  // and admit them on their second miss.
+  bool SeenBefore(std::string_view wkb) {
+    size_t hash = std::hash<std::string_view>{}(wkb);
+    if (seen_hashes_.erase(hash) > 0) {
+      return true;
+    }
+
+    if (seen_hashes_.size() >= kMaxSeenHashes) {
+      seen_hashes_.clear();
+    }
+
+    seen_hashes_.insert(hash);
+    return false;
+  }
 
   void StashIfNeeded(int64_t i, bool prepare = false) {
     if (i != stashed_index_) {
@@ -859,12 +1720,27 @@ class GeoArrowGeographyInputView {
 
       stashed_.Init(geom);
       stashed_index_ = i;
+      CountParsed(inner.size());
 
       if (prepare) {
-        stashed_.ForceBuildIndex();
+        Prepare(stashed_);
       }
     }
   }
+
+  void CountParsed(size_t num_bytes) {
+    if (stats_ != nullptr) {
+      stats_->num_bytes_parsed += static_cast<int64_t>(num_bytes);
+    }
+  }
+
+  void Prepare(GeoArrowGeography& value) {
+    if (stats_ != nullptr && value.is_unindexed()) {
+      ++stats_->num_index_builds;
+    }
+
+    value.ForceBuildIndex();
+  }
 };
 
 /// @}
@@ -883,8 +1759,41 @@ struct KernelData {
   bool prepare_arg0_scalar{true};
   bool prepare_arg1_scalar{true};
   bool prepare_arg2_scalar{true};
+  std::shared_ptr<const void> options;
+  size_t geography_cache_bytes{};
+  std::shared_ptr<GeographyCache> geography_cache;
+  bool collect_stats{};
+};
+
+/// \brief Private data for SedonaCScalarKernelImpl common to all adapters
+///
+/// The private_data of every impl points to one of these such that its
+/// members can be accessed without knowing the Exec.
+struct ImplDataBase {
+  std::string last_error;
+  ExecStats stats;
+  bool collect_stats{};
+
+  ExecStats* stats_or_null() { return collect_stats ? &stats : nullptr; }
 };
 
+/// \brief Collect ExecStats for impls of this kernel created afterwards
+inline void KernelSetCollectStats(struct SedonaCScalarKernel* self,
+                                  bool collect_stats) {
+  static_cast<KernelData*>(self->private_data)->collect_stats = collect_stats;
+}
+
+/// \brief Access the ExecStats of an impl (all zero unless collected)
+inline const ExecStats& KernelImplStats(
+    const struct SedonaCScalarKernelImpl* self) {
+  return static_cast<const ImplDataBase*>(self->private_data)->stats;
+}
+
+/// \brief Reset the ExecStats of an impl (e.g., between batches)
+inline void KernelImplResetStats(struct SedonaCScalarKernelImpl* self) {
+  static_cast<ImplDataBase*>(self->private_data)->stats.Reset();
+}
+
 inline const char* KernelFunctionName(const struct SedonaCScalarKernel* self) {
   return static_cast<KernelData*>(self->private_data)->name.c_str();
 }
@@ -897,23 +1806,52 @@ inline void KernelRelease(struct SedonaCScalarKernel* self) {
   self->release = nullptr;
 }
 
+/// \brief Enable a cache of prepared geographies for impls of this kernel
+///
+/// If shared is true, all impls created from this kernel (possibly used from
+/// different threads) look up and insert into a single cache of at most
+/// max_bytes; otherwise, each impl gets its own cache of that size. A
+/// max_bytes of zero disables caching for impls created afterwards.
+inline void KernelSetGeographyCache(struct SedonaCScalarKernel* self,
+                                    size_t max_bytes, bool shared) {
+  auto* data = static_cast<KernelData*>(self->private_data);
+  data->geography_cache_bytes = max_bytes;
+  if (shared && max_bytes > 0) {
+    data->geography_cache = std::make_shared<GeographyCache>(max_bytes);
+  } else {
+    data->geography_cache.reset();
+  }
+}
+
+/// \brief Resolve the cache to use for a new impl of this kernel
+inline std::shared_ptr<GeographyCache> KernelNewImplGeographyCache(
+    const KernelData* data) {
+  if (data->geography_cache) {
+    return data->geography_cache;
+  } else if (data->geography_cache_bytes > 0) {
+    return std::make_shared<GeographyCache>(data->geography_cache_bytes);
+  } else {
+    return nullptr;
+  }
+}
+
 /// \brief Sedona C ABI adapter for unary UDFs (one argument)
 template <typename Exec>
 class SedonaUnaryKernelAdapter {
  public:
-  struct ImplData {
-    std::string last_error;
+  struct ImplData : public ImplDataBase {
     std::unique_ptr<typename Exec::arg0_t> arg0;
     std::unique_ptr<typename Exec::out_t> out;
     Exec exec;
     bool prepare_arg0_scalar{true};
+    std::shared_ptr<GeographyCache> geography_cache;
   };
 
   static int ImplInit(struct SedonaCScalarKernelImpl* self,
                       const struct ArrowSchema* const* arg_types,
                       struct ArrowArray* const* /*scalar_args*/, int64_t n_args,
                       struct ArrowSchema* out) {
-    auto* data = static_cast<ImplData*>(self->private_data);
+    auto* data = ImplDataFrom(self);
     data->last_error.clear();
     try {
       // Check if this kernel applies to the input arguments
@@ -924,8 +1862,14 @@ class SedonaUnaryKernelAdapter {
 
       data->arg0 = std::make_unique<typename Exec::arg0_t>(arg_types[0]);
       data->arg0->SetPrepareScalar(data->prepare_arg0_scalar);
+      data->arg0->SetCache(data->geography_cache);
+      data->arg0->SetStats(data->stats_or_null());
       data->out = std::make_unique<typename Exec::out_t>();
 
+      if constexpr (has_exec_stats<Exec>::value) {
+        data->exec.SetStats(data->stats_or_null());
+      }
+
       if constexpr (has_exec_init<Exec>::value) {
         data->exec.Init(data->arg0.get(), data->out.get());
       }
@@ -947,7 +1891,7 @@ class SedonaUnaryKernelAdapter {
   static int ImplExecute(struct SedonaCScalarKernelImpl* self,
                          struct ArrowArray* const* args, int64_t n_args,
                          int64_t n_rows, struct ArrowArray* out) {
-    auto* data = static_cast<ImplData*>(self->private_data);
+    auto* data = ImplDataFrom(self);
     data->last_error.clear();
     try {
       if (n_args != 1) {
@@ -959,15 +1903,23 @@ class SedonaUnaryKernelAdapter {
       int64_t num_iterations = ExecuteNumIterations(n_rows, args, n_args);
       data->out->Reserve(num_iterations);
 
-      for (int64_t i = 0; i < num_iterations; i++) {
-        if (data->arg0->IsNull(i)) {
-          data->out->AppendNull();
-        } else {
-          typename Exec::arg0_t::c_type item0 = data->arg0->Get(i);
-          data->exec.Exec(item0, data->out.get());
+      if constexpr (has_exec_batch<Exec>::value) {
+        if (!data->collect_stats &&
+            data->exec.ExecBatch(data->arg0.get(), num_iterations,
+                                 data->out.get())) {
+          data->out->Finish(out);
+          return NANOARROW_OK;
         }
       }
 
+      if (data->collect_stats) {
+        ExecuteRows<true, true>(data, num_iterations);
+      } else if (data->arg0->MayHaveNulls()) {
+        ExecuteRows<true, false>(data, num_iterations);
+      } else {
+        ExecuteRows<false, false>(data, num_iterations);
+      }
+
       data->out->Finish(out);
       return NANOARROW_OK;
     } catch (std::exception& e) {
@@ -976,13 +1928,44 @@ class SedonaUnaryKernelAdapter {
     }
   }
 
+  // Instantiated separately for null-free input and without statistics
+  // such that the common case has no per-row branches beyond the Exec itself
+  template <bool kCheckNulls, bool kCollectStats>
+  static void ExecuteRows(ImplData* data, int64_t num_iterations) {
+    ExecStats* stats = kCollectStats ? data->stats_or_null() : nullptr;
+    ExecStatsBatch batch_stats(stats, num_iterations);
+    for (int64_t i = 0; i < num_iterations; i++) {
+      if constexpr (kCheckNulls) {
+        if (data->arg0->IsNull(i)) {
+          data->out->AppendNull();
+          if constexpr (kCollectStats) ++stats->num_null_rows;
+          continue;
+        }
+      }
+
+      typename Exec::arg0_t::c_type item0 = data->arg0->Get(i);
+      if constexpr (kCollectStats) {
+        int unindexed = CountUnindexed(item0);
+        data->exec.Exec(item0, data->out.get());
+        stats->num_index_builds += unindexed - CountUnindexed(item0);
+      } else {
+        data->exec.Exec(item0, data->out.get());
+      }
+    }
+  }
+
+  static ImplData* ImplDataFrom(struct SedonaCScalarKernelImpl* self) {
+    return static_cast<ImplData*>(
+        static_cast<ImplDataBase*>(self->private_data));
+  }
+
   static const char* ImplGetLastError(struct SedonaCScalarKernelImpl* self) {
-    return static_cast<ImplData*>(self->private_data)->last_error.c_str();
+    return ImplDataFrom(self)->last_error.c_str();
   }
 
   static void ImplRelease(struct SedonaCScalarKernelImpl* self) {
     if (self->private_data != nullptr) {
-      delete static_cast<ImplData*>(self->private_data);
+      delete ImplDataFrom(self);
       self->private_data = nullptr;
     }
     self->release = nullptr;
@@ -992,9 +1975,18 @@ class SedonaUnaryKernelAdapter {
                       struct SedonaCScalarKernelImpl* out) {
     auto* kernel_private = static_cast<KernelData*>(self->private_data);
     auto* impl_private = new ImplData();
+    impl_private->geography_cache = KernelNewImplGeographyCache(kernel_private);
+    impl_private->collect_stats = kernel_private->collect_stats;
     impl_private->prepare_arg0_scalar = kernel_private->prepare_arg0_scalar;
+    if constexpr (has_exec_options<Exec>::value) {
+      if (kernel_private->options) {
+        impl_private->exec.SetOptions(
+            *static_cast<const typename Exec::options_t*>(
+                kernel_private->options.get()));
+      }
+    }
 
-    out->private_data = impl_private;
+    out->private_data = static_cast<ImplDataBase*>(impl_private);
     out->init = &ImplInit;
     out->execute = &ImplExecute;
     out->get_last_error = &ImplGetLastError;
@@ -1006,21 +1998,21 @@ class SedonaUnaryKernelAdapter {
 template <typename Exec>
 class SedonaBinaryKernelAdapter {
  public:
-  struct ImplData {
-    std::string last_error;
+  struct ImplData : public ImplDataBase {
     std::unique_ptr<typename Exec::arg0_t> arg0;
     std::unique_ptr<typename Exec::arg1_t> arg1;
     std::unique_ptr<typename Exec::out_t> out;
     Exec exec;
     bool prepare_arg0_scalar{true};
     bool prepare_arg1_scalar{true};
+    std::shared_ptr<GeographyCache> geography_cache;
   };
 
   static int ImplInit(struct SedonaCScalarKernelImpl* self,
                       const struct ArrowSchema* const* arg_types,
                       struct ArrowArray* const* /*scalar_args*/, int64_t n_args,
                       struct ArrowSchema* out) {
-    auto* data = static_cast<ImplData*>(self->private_data);
+    auto* data = ImplDataFrom(self);
     data->last_error.clear();
     try {
       // Check if this kernel applies to the input arguments
@@ -1033,9 +2025,17 @@ class SedonaBinaryKernelAdapter {
       data->arg0 = std::make_unique<typename Exec::arg0_t>(arg_types[0]);
       data->arg1 = std::make_unique<typename Exec::arg1_t>(arg_types[1]);
       data->arg0->SetPrepareScalar(data->prepare_arg0_scalar);
+      data->arg0->SetCache(data->geography_cache);
+      data->arg0->SetStats(data->stats_or_null());
       data->arg1->SetPrepareScalar(data->prepare_arg1_scalar);
+      data->arg1->SetCache(data->geography_cache);
+      data->arg1->SetStats(data->stats_or_null());
       data->out = std::make_unique<typename Exec::out_t>();
 
+      if constexpr (has_exec_stats<Exec>::value) {
+        data->exec.SetStats(data->stats_or_null());
+      }
+
       if constexpr (has_exec_init_binary<Exec>::value) {
         data->exec.Init(data->arg0.get(), data->arg1.get(), data->out.get());
       }
@@ -1059,7 +2059,7 @@ class SedonaBinaryKernelAdapter {
   static int ImplExecute(struct SedonaCScalarKernelImpl* self,
                          struct ArrowArray* const* args, int64_t n_args,
                          int64_t n_rows, struct ArrowArray* out) {
-    auto* data = static_cast<ImplData*>(self->private_data);
+    auto* data = ImplDataFrom(self);
     data->last_error.clear();
     try {
       if (n_args != 2) {
@@ -1073,16 +2073,23 @@ class SedonaBinaryKernelAdapter {
       int64_t num_iterations = ExecuteNumIterations(n_rows, args, n_args);
       data->out->Reserve(num_iterations);
 
-      for (int64_t i = 0; i < num_iterations; i++) {
-        if (data->arg0->IsNull(i) || data->arg1->IsNull(i)) {
-          data->out->AppendNull();
-        } else {
-          typename Exec::arg0_t::c_type item0 = data->arg0->Get(i);
-          typename Exec::arg1_t::c_type item1 = data->arg1->Get(i);
-          data->exec.Exec(item0, item1, data->out.get());
+      if constexpr (has_exec_batch_binary<Exec>::value) {
+        if (!data->collect_stats &&
+            data->exec.ExecBatch(data->arg0.get(), data->arg1.get(),
+                                 num_iterations, data->out.get())) {
+          data->out->Finish(out);
+          return NANOARROW_OK;
         }
       }
 
+      if (data->collect_stats) {
+        ExecuteRows<true, true>(data, num_iterations);
+      } else if (data->arg0->MayHaveNulls() || data->arg1->MayHaveNulls()) {
+        ExecuteRows<true, false>(data, num_iterations);
+      } else {
+        ExecuteRows<false, false>(data, num_iterations);
+      }
+
       data->out->Finish(out);
       return 0;
     } catch (std::exception& e) {
@@ -1091,13 +2098,44 @@ class SedonaBinaryKernelAdapter {
     }
   }
 
+  template <bool kCheckNulls, bool kCollectStats>
+  static void ExecuteRows(ImplData* data, int64_t num_iterations) {
+    ExecStats* stats = kCollectStats ? data->stats_or_null() : nullptr;
+    ExecStatsBatch batch_stats(stats, num_iterations);
+    for (int64_t i = 0; i < num_iterations; i++) {
+      if constexpr (kCheckNulls) {
+        if (data->arg0->IsNull(i) || data->arg1->IsNull(i)) {
+          data->out->AppendNull();
+          if constexpr (kCollectStats) ++stats->num_null_rows;
+          continue;
+        }
+      }
+
+      typename Exec::arg0_t::c_type item0 = data->arg0->Get(i);
+      typename Exec::arg1_t::c_type item1 = data->arg1->Get(i);
+      if constexpr (kCollectStats) {
+        int unindexed = CountUnindexed(item0) + CountUnindexed(item1);
+        data->exec.Exec(item0, item1, data->out.get());
+        stats->num_index_builds +=
+            unindexed - CountUnindexed(item0) - CountUnindexed(item1);
+      } else {
+        data->exec.Exec(item0, item1, data->out.get());
+      }
+    }
+  }
+
+  static ImplData* ImplDataFrom(struct SedonaCScalarKernelImpl* self) {
+    return static_cast<ImplData*>(
+        static_cast<ImplDataBase*>(self->private_data));
+  }
+
   static const char* ImplGetLastError(struct SedonaCScalarKernelImpl* self) {
-    return static_cast<ImplData*>(self->private_data)->last_error.c_str();
+    return ImplDataFrom(self)->last_error.c_str();
   }
 
   static void ImplRelease(struct SedonaCScalarKernelImpl* self) {
     if (self->private_data != nullptr) {
-      delete static_cast<ImplData*>(self->private_data);
+      delete ImplDataFrom(self);
       self->private_data = nullptr;
     }
     self->release = nullptr;
@@ -1107,10 +2145,12 @@ class SedonaBinaryKernelAdapter {
                       struct SedonaCScalarKernelImpl* out) {
     auto* kernel_private = static_cast<KernelData*>(self->private_data);
     auto* impl_private = new ImplData();
+    impl_private->geography_cache = KernelNewImplGeographyCache(kernel_private);
+    impl_private->collect_stats = kernel_private->collect_stats;
     impl_private->prepare_arg0_scalar = kernel_private->prepare_arg0_scalar;
     impl_private->prepare_arg1_scalar = kernel_private->prepare_arg1_scalar;
 
-    out->private_data = impl_private;
+    out->private_data = static_cast<ImplDataBase*>(impl_private);
     out->init = &ImplInit;
     out->execute = &ImplExecute;
     out->get_last_error = &ImplGetLastError;
@@ -1122,8 +2162,7 @@ class SedonaBinaryKernelAdapter {
 template <typename Exec>
 class SedonaTernaryKernelAdapter {
  public:
-  struct ImplData {
-    std::string last_error;
+  struct ImplData : public ImplDataBase {
     std::unique_ptr<typename Exec::arg0_t> arg0;
     std::unique_ptr<typename Exec::arg1_t> arg1;
     std::unique_ptr<typename Exec::arg2_t> arg2;
@@ -1132,13 +2171,14 @@ class SedonaTernaryKernelAdapter {
     bool prepare_arg0_scalar{true};
     bool prepare_arg1_scalar{true};
     bool prepare_arg2_scalar{true};
+    std::shared_ptr<GeographyCache> geography_cache;
   };
 
   static int ImplInit(struct SedonaCScalarKernelImpl* self,
                       const struct ArrowSchema* const* arg_types,
                       struct ArrowArray* const* /*scalar_args*/, int64_t n_args,
                       struct ArrowSchema* out) {
-    auto* data = static_cast<ImplData*>(self->private_data);
+    auto* data = ImplDataFrom(self);
     data->last_error.clear();
     try {
       // Check if this kernel applies to the input arguments
@@ -1153,10 +2193,20 @@ class SedonaTernaryKernelAdapter {
       data->arg1 = std::make_unique<typename Exec::arg1_t>(arg_types[1]);
       data->arg2 = std::make_unique<typename Exec::arg2_t>(arg_types[2]);
       data->arg0->SetPrepareScalar(data->prepare_arg0_scalar);
+      data->arg0->SetCache(data->geography_cache);
+      data->arg0->SetStats(data->stats_or_null());
       data->arg1->SetPrepareScalar(data->prepare_arg1_scalar);
+      data->arg1->SetCache(data->geography_cache);
+      data->arg1->SetStats(data->stats_or_null());
       data->arg2->SetPrepareScalar(data->prepare_arg2_scalar);
+      data->arg2->SetCache(data->geography_cache);
+      data->arg2->SetStats(data->stats_or_null());
       data->out = std::make_unique<typename Exec::out_t>();
 
+      if constexpr (has_exec_stats<Exec>::value) {
+        data->exec.SetStats(data->stats_or_null());
+      }
+
       if constexpr (has_exec_init_ternary<Exec>::value) {
         data->exec.Init(data->arg0.get(), data->arg1.get(), data->arg2.get(),
                         data->out.get());
@@ -1181,7 +2231,7 @@ class SedonaTernaryKernelAdapter {
   static int ImplExecute(struct SedonaCScalarKernelImpl* self,
                          struct ArrowArray* const* args, int64_t n_args,
                          int64_t n_rows, struct ArrowArray* out) {
-    auto* data = static_cast<ImplData*>(self->private_data);
+    auto* data = ImplDataFrom(self);
     data->last_error.clear();
     try {
       if (n_args != 3) {
@@ -1196,16 +2246,13 @@ class SedonaTernaryKernelAdapter {
       int64_t num_iterations = ExecuteNumIterations(n_rows, args, n_args);
       data->out->Reserve(num_iterations);
 
-      for (int64_t i = 0; i < num_iterations; i++) {
-        if (data->arg0->IsNull(i) || data->arg1->IsNull(i) ||
-            data->arg2->IsNull(i)) {
-          data->out->AppendNull();
-        } else {
-          typename Exec::arg0_t::c_type item0 = data->arg0->Get(i);
-          typename Exec::arg1_t::c_type item1 = data->arg1->Get(i);
-          typename Exec::arg2_t::c_type item2 = data->arg2->Get(i);
-          data->exec.Exec(item0, item1, item2, data->out.get());
-        }
+      if (data->collect_stats) {
+        ExecuteRows<true, true>(data, num_iterations);
+      } else if (data->arg0->MayHaveNulls() || data->arg1->MayHaveNulls() ||
+                 data->arg2->MayHaveNulls()) {
+        ExecuteRows<true, false>(data, num_iterations);
+      } else {
+        ExecuteRows<false, false>(data, num_iterations);
       }
 
       data->out->Finish(out);
@@ -1216,13 +2263,48 @@ class SedonaTernaryKernelAdapter {
     }
   }
 
+  template <bool kCheckNulls, bool kCollectStats>
+  static void ExecuteRows(ImplData* data, int64_t num_iterations) {
+    ExecStats* stats = kCollectStats ? data->stats_or_null() : nullptr;
+    ExecStatsBatch batch_stats(stats, num_iterations);
+    for (int64_t i = 0; i < num_iterations; i++) {
+      if constexpr (kCheckNulls) {
+        if (data->arg0->IsNull(i) || data->arg1->IsNull(i) ||
+            data->arg2->IsNull(i)) {
+          data->out->AppendNull();
+          if constexpr (kCollectStats) ++stats->num_null_rows;
+          continue;
+        }
+      }
+
+      typename Exec::arg0_t::c_type item0 = data->arg0->Get(i);
+      typename Exec::arg1_t::c_type item1 = data->arg1->Get(i);
+      typename Exec::arg2_t::c_type item2 = data->arg2->Get(i);
+      if constexpr (kCollectStats) {
+        int unindexed = CountUnindexed(item0) + CountUnindexed(item1) +
+                        CountUnindexed(item2);
+        data->exec.Exec(item0, item1, item2, data->out.get());
+        stats->num_index_builds += unindexed - CountUnindexed(item0) -
+                                   CountUnindexed(item1) -
+                                   CountUnindexed(item2);
+      } else {
+        data->exec.Exec(item0, item1, item2, data->out.get());
+      }
+    }
+  }
+
+  static ImplData* ImplDataFrom(struct SedonaCScalarKernelImpl* self) {
+    return static_cast<ImplData*>(
+        static_cast<ImplDataBase*>(self->private_data));
+  }
+
   static const char* ImplGetLastError(struct SedonaCScalarKernelImpl* self) {
-    return static_cast<ImplData*>(self->private_data)->last_error.c_str();
+    return ImplDataFrom(self)->last_error.c_str();
   }
 
   static void ImplRelease(struct SedonaCScalarKernelImpl* self) {
     if (self->private_data != nullptr) {
-      delete static_cast<ImplData*>(self->private_data);
+      delete ImplDataFrom(self);
       self->private_data = nullptr;
     }
     self->release = nullptr;
@@ -1232,11 +2314,13 @@ class SedonaTernaryKernelAdapter {
                       struct SedonaCScalarKernelImpl* out) {
     auto* kernel_private = static_cast<KernelData*>(self->private_data);
     auto* impl_private = new ImplData();
+    impl_private->geography_cache = KernelNewImplGeographyCache(kernel_private);
+    impl_private->collect_stats = kernel_private->collect_stats;
     impl_private->prepare_arg0_scalar = kernel_private->prepare_arg0_scalar;
     impl_private->prepare_arg1_scalar = kernel_private->prepare_arg1_scalar;
     impl_private->prepare_arg2_scalar = kernel_private->prepare_arg2_scalar;
 
-    out->private_data = impl_private;
+    out->private_data = static_cast<ImplDataBase*>(impl_private);
     out->init = &ImplInit;
     out->execute = &ImplExecute;
     out->get_last_error = &ImplGetLastError;
@@ -1255,6 +2339,18 @@ void InitUnaryKernel(struct SedonaCScalarKernel* out, const char* name,
   out->release = &KernelRelease;
 }
 
+/// \brief Initialize a SedonaCScalarKernel for a unary Exec whose
+/// options are fixed when the kernel is created
+template <typename Exec>
+void InitUnaryKernelWithOptions(struct SedonaCScalarKernel* out,
+                                const char* name,
+                                typename Exec::options_t options,
+                                bool prepare_arg0_scalar = true) {
+  InitUnaryKernel<Exec>(out, name, prepare_arg0_scalar);
+  static_cast<KernelData*>(out->private_data)->options =
+      std::make_shared<const typename Exec::options_t>(std::move(options));
+}
+
 /// \brief Initialize a SedonaCScalarKernel for a binary Exec
 template <typename Exec>
 void InitBinaryKernel(struct SedonaCScalarKernel* out, const char* name,
@@ -5,6 +5,8 @@
 #include "s2geography/accessors-geog.h"
 #include "s2geography/accessors.h"
 #include "s2geography/linear-referencing.h"
+#include "s2geography/predicates.h"
+#include "s2geography/sedona_udf/sedona_udf_internal.h"
 #include "s2geography/sedona_udf/sedona_udf_test_internal.h"
 
 // Tests the matching of the Arrow argument and also propagation of the CRS from
@@ -124,6 +126,45 @@ TEST(SedonaUdf, ArrowOutputMultipleExecuteCalls) {
   kernel.release(&kernel);
 }
 
+// Check boolean output that spans more than one byte both for null-free input
+// (where no validity buffer is written) and for input that contains nulls.
+TEST(SedonaUdf, ArrowOutputNullFreeAndNullable) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::IntersectsKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB}, NANOARROW_TYPE_BOOL));
+
+  std::vector<std::optional<std::string>> points;
+  std::vector<std::optional<double>> expected;
+  for (int i = 0; i < 10; i++) {
+    bool inside = i % 3 == 0;
+    points.push_back(inside ? "POINT (0.25 0.25)" : "POINT (-1 -1)");
+    expected.push_back(inside);
+  }
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+      {{"POLYGON ((0 0, 1 0, 0 1, 0 0))"}, points}, {}, out_array.get()));
+  ASSERT_EQ(out_array->null_count, 0);
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultArrow(out_array.get(), NANOARROW_TYPE_BOOL, expected));
+
+  points[9] = std::nullopt;
+  expected[9] = std::nullopt;
+  out_array.reset();
+  ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+      &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+      {{"POLYGON ((0 0, 1 0, 0 1, 0 0))"}, points}, {}, out_array.get()));
+  ASSERT_EQ(out_array->null_count, 1);
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultArrow(out_array.get(), NANOARROW_TYPE_BOOL, expected));
+
+  impl.release(&impl);
+  kernel.release(&kernel);
+}
+
 // Check that the same SedonaCScalarKernelImpl with Arrow output can be executed
 // more than once.
 TEST(SedonaUdf, GeographyOutputMultipleExecuteCalls) {
@@ -156,3 +197,311 @@ TEST(SedonaUdf, GeographyOutputMultipleExecuteCalls) {
   impl.release(&impl);
   kernel.release(&kernel);
 }
+
+// Check that dictionary-encoded geography input is decoded per dictionary
+// value and that nulls in either the indices or the dictionary propagate
+TEST(SedonaUdf, GeographyInputDictionary) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::IntersectsKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  kernel.new_impl(&kernel, &impl);
+
+  nanoarrow::UniqueSchema arg0;
+  ASSERT_EQ(ArrowSchemaInitFromType(arg0.get(), NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(arg0.get()), NANOARROW_OK);
+  ::geoarrow::Wkb()
+      .WithEdgeType(GEOARROW_EDGE_TYPE_SPHERICAL)
+      .InitSchema(arg0->dictionary);
+  auto arg1 = std::move(ArgSchemas({ARROW_TYPE_WKB})[0]);
+  const struct ArrowSchema* arg_types[] = {arg0.get(), arg1.get()};
+
+  nanoarrow::UniqueSchema out;
+  ASSERT_EQ(impl.init(&impl, arg_types, nullptr, 2, out.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NE(out->release, nullptr);
+
+  auto indices = ArgArrow(NANOARROW_TYPE_INT32, {0, 0, 0, 1, std::nullopt});
+  auto dictionary = ArgWkb({"POLYGON ((0 0, 0 1, 1 0, 0 0))", std::nullopt});
+  ASSERT_EQ(ArrowArrayAllocateDictionary(indices.get()), NANOARROW_OK);
+  ArrowArrayMove(dictionary.get(), indices->dictionary);
+
+  auto points = ArgWkb({"POINT (0.25 0.25)", "POINT (5 5)", "POINT (0.1 0.1)",
+                        "POINT (0 0)", "POINT (0 0)"});
+  struct ArrowArray* args[] = {indices.get(), points.get()};
+
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(impl.execute(&impl, args, 2, 5, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultArrow(out_array.get(), NANOARROW_TYPE_BOOL,
+                      {true, false, true, std::nullopt, std::nullopt}));
+
+  // An empty batch (e.g., the tail of a sliced array) is not an error and
+  // does not affect the next batch
+  auto empty_indices = ArgArrow(NANOARROW_TYPE_INT32, {});
+  auto empty_dictionary = ArgWkb({"POINT (0 0)"});
+  ASSERT_EQ(ArrowArrayAllocateDictionary(empty_indices.get()), NANOARROW_OK);
+  ArrowArrayMove(empty_dictionary.get(), empty_indices->dictionary);
+  auto empty_points = ArgWkb({});
+  struct ArrowArray* empty_args[] = {empty_indices.get(), empty_points.get()};
+
+  out_array.reset();
+  ASSERT_EQ(impl.execute(&impl, empty_args, 2, 0, out_array.get()),
+            NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultArrow(out_array.get(), NANOARROW_TYPE_BOOL, {}));
+
+  out_array.reset();
+  ASSERT_EQ(impl.execute(&impl, args, 2, 5, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultArrow(out_array.get(), NANOARROW_TYPE_BOOL,
+                      {true, false, true, std::nullopt, std::nullopt}));
+
+  impl.release(&impl);
+  kernel.release(&kernel);
+}
+
+// Check that run-end-encoded geography input resolves each row to its run
+TEST(SedonaUdf, GeographyInputRunEndEncoded) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::AreaKernel(&kernel);
+  struct SedonaCScalarKernelImpl impl;
+  kernel.new_impl(&kernel, &impl);
+
+  nanoarrow::UniqueSchema arg0;
+  ArrowSchemaInit(arg0.get());
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(arg0.get(), NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  arg0->children[1]->release(arg0->children[1]);
+  ::geoarrow::Wkb()
+      .WithEdgeType(GEOARROW_EDGE_TYPE_SPHERICAL)
+      .InitSchema(arg0->children[1]);
+  const struct ArrowSchema* arg_types[] = {arg0.get()};
+
+  nanoarrow::UniqueSchema out;
+  ASSERT_EQ(impl.init(&impl, arg_types, nullptr, 1, out.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NE(out->release, nullptr);
+
+  nanoarrow::UniqueArray ree;
+  ASSERT_EQ(ArrowArrayInitFromSchema(ree.get(), arg0.get(), nullptr),
+            NANOARROW_OK);
+  auto run_ends = ArgArrow(NANOARROW_TYPE_INT32, {2, 3, 5, 6});
+  auto values = ArgWkb({"POLYGON ((0 0, 0 1, 1 0, 0 0))", "POINT (0 1)",
+                        std::nullopt, "POLYGON ((0 0, 0 0.1, 0.1 0, 0 0))"});
+  ree->children[0]->release(ree->children[0]);
+  ArrowArrayMove(run_ends.get(), ree->children[0]);
+  ree->children[1]->release(ree->children[1]);
+  ArrowArrayMove(values.get(), ree->children[1]);
+  ree->length = 6;
+  ree->null_count = 0;
+
+  struct ArrowArray* args[] = {ree.get()};
+  nanoarrow::UniqueArray out_array;
+  ASSERT_EQ(impl.execute(&impl, args, 1, 6, out_array.get()), NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+      out_array.get(), NANOARROW_TYPE_DOUBLE,
+      {6182489130.9071951, 6182489130.9071951, 0.0, std::nullopt,
+       std::nullopt, 61821784.015993997}));
+
+  // An empty batch may have empty run ends and values
+  nanoarrow::UniqueArray empty_ree;
+  ASSERT_EQ(ArrowArrayInitFromSchema(empty_ree.get(), arg0.get(), nullptr),
+            NANOARROW_OK);
+  auto empty_run_ends = ArgArrow(NANOARROW_TYPE_INT32, {});
+  auto empty_values = ArgWkb({});
+  empty_ree->children[0]->release(empty_ree->children[0]);
+  ArrowArrayMove(empty_run_ends.get(), empty_ree->children[0]);
+  empty_ree->children[1]->release(empty_ree->children[1]);
+  ArrowArrayMove(empty_values.get(), empty_ree->children[1]);
+  empty_ree->length = 0;
+  empty_ree->null_count = 0;
+
+  struct ArrowArray* empty_args[] = {empty_ree.get()};
+  out_array.reset();
+  ASSERT_EQ(impl.execute(&impl, empty_args, 1, 0, out_array.get()),
+            NANOARROW_OK)
+      << impl.get_last_error(&impl);
+  ASSERT_NO_FATAL_FAILURE(
+      TestResultArrow(out_array.get(), NANOARROW_TYPE_DOUBLE, {}));
+
+  impl.release(&impl);
+  kernel.release(&kernel);
+}
+
+TEST(SedonaUdf, GeographyCache) {
+  using s2geography::sedona_udf::GeographyCache;
+
+  auto wkb = ArgWkb({"POLYGON ((0 0, 0 1, 1 0, 0 0))", "POINT (0 1)"});
+  nanoarrow::UniqueArrayView wkb_view;
+  ArrowArrayViewInitFromType(wkb_view.get(), NANOARROW_TYPE_BINARY);
+  ASSERT_EQ(ArrowArrayViewSetArray(wkb_view.get(), wkb.get(), nullptr),
+            NANOARROW_OK);
+  struct ArrowBufferView polygon_buf =
+      ArrowArrayViewGetBytesUnsafe(wkb_view.get(), 0);
+  struct ArrowBufferView point_buf =
+      ArrowArrayViewGetBytesUnsafe(wkb_view.get(), 1);
+  std::string_view polygon(polygon_buf.data.as_char, polygon_buf.size_bytes);
+  std::string_view point(point_buf.data.as_char, point_buf.size_bytes);
+
+  struct GeoArrowWKBReader reader;
+  ASSERT_EQ(GeoArrowWKBReaderInit(&reader), GEOARROW_OK);
+
+  GeographyCache cache(1024 * 1024);
+  EXPECT_EQ(cache.Lookup(polygon), nullptr);
+
+  bool is_new = false;
+  auto entry = cache.Insert(polygon, &reader, true, &is_new);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_TRUE(is_new);
+  EXPECT_EQ(entry->wkb(), polygon);
+  EXPECT_EQ(entry->geog().dimension(), 2);
+  EXPECT_FALSE(entry->geog().is_unindexed());
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.bytes_used(), entry->mem_used());
+
+  // Entries own their bytes and are found by content
+  std::string polygon_copy(polygon);
+  EXPECT_EQ(cache.Lookup(polygon_copy), entry);
+  EXPECT_EQ(cache.num_hits(), 1);
+  EXPECT_EQ(cache.num_misses(), 1);
+
+  // An insert that loses a race with an identical insert returns the
+  // existing entry
+  EXPECT_EQ(cache.Insert(polygon_copy, &reader, true, &is_new), entry);
+  EXPECT_FALSE(is_new);
+  EXPECT_EQ(cache.size(), 1);
+
+  // Inserting past the limit evicts the least recently used entry while
+  // entries that are still referenced remain valid
+  GeographyCache small_cache(entry->mem_used());
+  auto small_entry = small_cache.Insert(polygon, &reader, true);
+  small_cache.Insert(point, &reader, true);
+  EXPECT_EQ(small_cache.size(), 1);
+  EXPECT_EQ(small_cache.Lookup(polygon), nullptr);
+  EXPECT_NE(small_cache.Lookup(point), nullptr);
+  EXPECT_EQ(small_entry->geog().dimension(), 2);
+
+  // Entries larger than the cache are returned but not kept
+  GeographyCache tiny_cache(1);
+  EXPECT_NE(tiny_cache.Insert(polygon, &reader, true), nullptr);
+  EXPECT_EQ(tiny_cache.size(), 0);
+  EXPECT_EQ(tiny_cache.bytes_used(), 0);
+
+  // An index built lazily after inserting is charged once it is reported
+  GeographyCache lazy_cache(1024 * 1024);
+  auto lazy_entry = lazy_cache.Insert(polygon, &reader, false);
+  EXPECT_TRUE(lazy_entry->geog().is_unindexed());
+  size_t unindexed_bytes = lazy_cache.bytes_used();
+  EXPECT_EQ(unindexed_bytes, lazy_entry->mem_used());
+  lazy_cache.UpdateMemUsed(*lazy_entry);
+  EXPECT_EQ(lazy_cache.bytes_used(), unindexed_bytes);
+
+  lazy_entry->geog().Covering();
+  ASSERT_FALSE(lazy_entry->geog().is_unindexed());
+  lazy_cache.UpdateMemUsed(*lazy_entry);
+  EXPECT_GT(lazy_cache.bytes_used(), unindexed_bytes);
+  EXPECT_EQ(lazy_cache.bytes_used(), lazy_entry->mem_used());
+
+  GeoArrowWKBReaderReset(&reader);
+}
+
+// Check that a kernel-level cache is shared among impls and persists across
+// batches
+TEST(SedonaUdf, GeographyCacheShared) {
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::IntersectsKernel(&kernel);
+  s2geography::sedona_udf::KernelSetGeographyCache(&kernel, 1024 * 1024,
+                                                   true);
+  auto cache = static_cast<s2geography::sedona_udf::KernelData*>(
+                   kernel.private_data)
+                   ->geography_cache;
+  ASSERT_NE(cache, nullptr);
+
+  for (int i = 0; i < 2; i++) {
+    struct SedonaCScalarKernelImpl impl;
+    ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+        &kernel, &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB}, NANOARROW_TYPE_BOOL));
+
+    for (int j = 0; j < 2; j++) {
+      nanoarrow::UniqueArray out_array;
+      ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+          &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+          {{"POLYGON ((0 0, 0 1, 1 0, 0 0))"},
+           {"POINT (0.25 0.25)", "POINT (5 5)", std::nullopt}},
+          {}, out_array.get()));
+      ASSERT_NO_FATAL_FAILURE(TestResultArrow(
+          out_array.get(), NANOARROW_TYPE_BOOL, {true, false, std::nullopt}));
+    }
+
+    impl.release(&impl);
+  }
+
+  // The scalar polygon was inserted once and found by every other batch. The
+  // points were each seen once per batch and were not admitted until
+  // the second batch.
+  EXPECT_EQ(cache->num_hits(), 3 + 4);
+  EXPECT_EQ(cache->size(), 3);
+
+  kernel.release(&kernel);
+}
+
+TEST(SedonaUdf, ExecStats) {
+  using s2geography::sedona_udf::ExecStats;
+  using s2geography::sedona_udf::ExecStrategy;
+
+  struct SedonaCScalarKernel kernel;
+  s2geography::sedona_udf::IntersectsKernel(&kernel);
+  s2geography::sedona_udf::KernelSetCollectStats(&kernel, true);
+
+  struct SedonaCScalarKernelImpl impl;
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB}, NANOARROW_TYPE_BOOL));
+
+  for (int i = 0; i < 2; i++) {
+    nanoarrow::UniqueArray out_array;
+    ASSERT_NO_FATAL_FAILURE(TestExecuteKernel(
+        &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+        {{"POLYGON ((0 0, 0 1, 1 0, 0 0))"},
+         {"POINT (0.25 0.25)", "POINT (5 5)", "POINT EMPTY", std::nullopt}},
+        {}, out_array.get()));
+    ASSERT_NO_FATAL_FAILURE(
+        TestResultArrow(out_array.get(), NANOARROW_TYPE_BOOL,
+                        {true, false, false, std::nullopt}));
+  }
+
+  const ExecStats& stats = s2geography::sedona_udf::KernelImplStats(&impl);
+  EXPECT_EQ(stats.num_batches, 2);
+  EXPECT_EQ(stats.num_rows, 8);
+  EXPECT_EQ(stats.num_null_rows, 2);
+  EXPECT_GT(stats.num_bytes_parsed, 0);
+  EXPECT_EQ(stats.num_strategy[static_cast<size_t>(ExecStrategy::kTrivial)],
+            2);
+  EXPECT_EQ(stats.num_strategy[static_cast<size_t>(ExecStrategy::kPoint)], 4);
+  EXPECT_EQ(
+      stats.num_strategy[static_cast<size_t>(ExecStrategy::kShapeIndex)], 0);
+
+  s2geography::sedona_udf::KernelImplResetStats(&impl);
+  EXPECT_EQ(stats.num_batches, 0);
+  EXPECT_EQ(stats.num_rows, 0);
+
+  impl.release(&impl);
+
+  // Without opting in, nothing is collected
+  s2geography::sedona_udf::KernelSetCollectStats(&kernel, false);
+  ASSERT_NO_FATAL_FAILURE(TestInitKernel(
+      &kernel, &impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB}, NANOARROW_TYPE_BOOL));
+  nanoarrow::UniqueArray out_array;
+  ASSERT_NO_FATAL_FAILURE(
+      TestExecuteKernel(&impl, {ARROW_TYPE_WKB, ARROW_TYPE_WKB},
+                        {{"POINT (0 0)"}, {"POINT (0 0)"}}, {},
+                        out_array.get()));
+  EXPECT_EQ(s2geography::sedona_udf::KernelImplStats(&impl).num_batches, 0);
+
+  impl.release(&impl);
+  kernel.release(&kernel);
+}
@@ -259,6 +259,80 @@ size_t S2GeogNumKernels(void);
 S2GeogErrorCode S2GeogInitKernels(void* kernels_array,
                                   size_t kernels_array_size_bytes, int format);
 
+/// \brief Enable a cache of prepared geographies for a kernel
+///
+/// Geographies that appear repeatedly across batches (e.g., a fixed set of
+/// polygons evaluated against a stream) are parsed and prepared once and
+/// kept in a least-recently-used cache of at most max_bytes. If shared is
+/// non-zero, all implementations created from this kernel afterwards share
+/// one thread-safe cache; otherwise, each implementation gets its own. A
+/// max_bytes of zero disables the cache.
+///
+/// \pre kernel was initialized by S2GeogInitKernels() with the same format
+S2GeogErrorCode S2GeogKernelSetGeographyCache(void* kernel, int format,
+                                              size_t max_bytes, int shared);
+
+/// \brief The result followed from emptiness or other trivial properties
+#define S2GEOGRAPHY_STRATEGY_TRIVIAL 0
+
+/// \brief A point-specific fast path was used
+#define S2GEOGRAPHY_STRATEGY_POINT 1
+
+/// \brief Non-intersecting coverings determined the result
+#define S2GEOGRAPHY_STRATEGY_COVERING_REJECTION 2
+
+/// \brief Edges were compared directly without building an index
+#define S2GEOGRAPHY_STRATEGY_BRUTE_FORCE 3
+
+/// \brief One side's index was queried using the other side's edges
+#define S2GEOGRAPHY_STRATEGY_SEMI_INDEXED 4
+
+/// \brief An operation on the shape indexes of both sides was used
+#define S2GEOGRAPHY_STRATEGY_SHAPE_INDEX 5
+
+/// \brief The number of S2GEOGRAPHY_STRATEGY_* values
+#define S2GEOGRAPHY_NUM_STRATEGIES 6
+
+/// \brief Execution statistics accumulated by a kernel implementation
+///
+/// num_strategy counts rows by the S2GEOGRAPHY_STRATEGY_* used to compute
+/// them and is only populated by kernels with more than one strategy (e.g.,
+/// predicates and distances). exec_time_ns is wall time spent computing
+/// batches.
+struct S2GeogKernelStats {
+  int64_t num_batches;
+  int64_t num_rows;
+  int64_t num_null_rows;
+  int64_t num_index_builds;
+  int64_t num_bytes_parsed;
+  int64_t exec_time_ns;
+  int64_t num_strategy[S2GEOGRAPHY_NUM_STRATEGIES];
+};
+
+/// \brief Collect statistics for implementations created from this kernel
+///
+/// Statistics are off by default and cost a clock read per batch and a few
+/// increments per row when enabled. Only implementations created after this
+/// call are affected.
+///
+/// \pre kernel was initialized by S2GeogInitKernels() with the same format
+S2GeogErrorCode S2GeogKernelSetCollectStats(void* kernel, int format,
+                                            int enabled);
+
+/// \brief Get the statistics accumulated by a kernel implementation
+///
+/// All values are zero if statistics were not collected.
+///
+/// \pre impl was created by a kernel with the same format
+/// \pre out != NULL
+S2GeogErrorCode S2GeogKernelImplGetStats(void* impl, int format,
+                                         struct S2GeogKernelStats* out);
+
+/// \brief Reset the statistics accumulated by a kernel implementation
+///
+/// \pre impl was created by a kernel with the same format
+S2GeogErrorCode S2GeogKernelImplResetStats(void* impl, int format);
+
 /// @}
 
 /// \defgroup operations Operators